@@ -0,0 +1,177 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Benchmark entry point
+* Runs the scenario suite headlessly, writes JSON results and gates on a baseline
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "BenchmarkReport.h"
+#include "BenchmarkRunner.h"
+#include "Scenario.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+	const int EXIT_REGRESSION = 1;
+	const int EXIT_USAGE = 2;
+
+	void printUsage()
+	{
+		std::cerr << "usage: BoxheadBenchmark [--scenarios <file>] [--only <name>] [--out <results.json>]\n"
+				  << "                        [--baseline <results.json>] [--threshold <fraction>] [--min-delta <ms>]\n"
+				  << "                        [--replay <file>]\n"
+				  << "Run from the game folder so Media/ resolves. Exits with "
+				  << EXIT_REGRESSION << " when a metric regresses past the threshold or a replay desyncs.\n"
+				  << "--replay times a recorded game (Boxhead --record <file>) instead of the scenarios.\n";
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::string scenarioPath = "../Benchmarks/Scenarios.txt";
+	std::string only;
+	std::string outPath;
+	std::string baselinePath;
+	std::string replayPath;
+	double threshold = 0.10;
+	double minimumDelta = 0.05;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+
+		if (i + 1 >= argc)
+		{
+			printUsage();
+			return EXIT_USAGE;
+		}
+
+		if (arg == "--scenarios")
+			scenarioPath = argv[++i];
+		else if (arg == "--only")
+			only = argv[++i];
+		else if (arg == "--out")
+			outPath = argv[++i];
+		else if (arg == "--baseline")
+			baselinePath = argv[++i];
+		else if (arg == "--replay")
+			replayPath = argv[++i];
+		else if (arg == "--threshold")
+			threshold = std::atof(argv[++i]);
+		else if (arg == "--min-delta")
+			minimumDelta = std::atof(argv[++i]);
+		else
+		{
+			printUsage();
+			return EXIT_USAGE;
+		}
+	}
+
+	try
+	{
+		std::vector<GEX::ScenarioResult> results;
+		GEX::BenchmarkRunner runner;
+
+		std::vector<GEX::Scenario> scenarios;
+		if (replayPath.empty())
+			scenarios = GEX::loadScenarios(scenarioPath);
+		else
+			results.push_back(runner.runReplay(replayPath));
+
+		for (const GEX::Scenario& scenario : scenarios)
+		{
+			if (!only.empty() && scenario.name != only)
+				continue;
+
+			results.push_back(runner.run(scenario));
+		}
+
+		for (const GEX::ScenarioResult& result : results)
+		{
+
+			std::cout << std::left << std::setw(16) << result.name << std::fixed << std::setprecision(3)
+					  << " mean " << result.overall.mean
+					  << "  p50 " << result.overall.p50
+					  << "  p99 " << result.overall.p99
+					  << "  max " << result.overall.max << " ms"
+					  << (result.playerSurvived ? "" : "  (player died, run cut short)") << "\n";
+
+			if (result.desyncs > 0)
+				std::cerr << "DESYNC " << result.name << ": " << result.desyncs << " keyframes differ\n";
+		}
+
+		if (!outPath.empty())
+		{
+			std::ofstream out(outPath);
+			if (!out)
+				throw std::runtime_error("Results could not be written to " + outPath);
+
+			GEX::writeReport(out, results);
+		}
+		else
+		{
+			GEX::writeReport(std::cout, results);
+		}
+
+		for (const GEX::ScenarioResult& result : results)
+		{
+			if (result.desyncs > 0)
+				return EXIT_REGRESSION;
+		}
+
+		if (!baselinePath.empty())
+		{
+			auto regressions = GEX::compareWithBaseline(results, baselinePath, threshold, minimumDelta);
+
+			for (const GEX::Regression& regression : regressions)
+			{
+				std::cerr << "REGRESSION " << regression.scenario << " " << regression.metric
+						  << ": " << regression.baseline << " -> " << regression.current << " ms\n";
+			}
+
+			if (!regressions.empty())
+				return EXIT_REGRESSION;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << "\n";
+		return EXIT_USAGE;
+	}
+
+	return EXIT_SUCCESS;
+}
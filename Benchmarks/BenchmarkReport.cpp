@@ -0,0 +1,265 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BenchmarkReport
+* Writes benchmark results as JSON and compares them against a baseline
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "BenchmarkReport.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace GEX
+{
+	namespace
+	{
+		void writeSummary(std::ostream& out, const TimingSummary& summary)
+		{
+			out << "{ \"mean\": " << summary.mean
+				<< ", \"p50\": " << summary.p50
+				<< ", \"p99\": " << summary.p99
+				<< ", \"max\": " << summary.max << " }";
+		}
+
+		// Just enough JSON to read back a report, every scalar is kept as text under its dotted
+		// path (e.g. "scenarios.crowd.overall.p99"), array elements are keyed by their "name" member
+		class BaselineReader
+		{
+		public:
+			explicit				BaselineReader(const std::string& text)
+			: text_(text)
+			, position_(0)
+			{
+			}
+
+			std::map<std::string, std::string> read()
+			{
+				std::map<std::string, std::string> values;
+				readValue("", values);
+				return values;
+			}
+
+		private:
+			static std::string		join(const std::string& path, const std::string& key)
+			{
+				return path.empty() ? key : path + "." + key;
+			}
+
+			void					readValue(const std::string& path, std::map<std::string, std::string>& values)
+			{
+				char next = peek();
+
+				if (next == '{')
+				{
+					expect('{');
+					if (peek() != '}')
+					{
+						do
+						{
+							std::string key = readString();
+							expect(':');
+							readValue(join(path, key), values);
+						} while (accept(','));
+					}
+					expect('}');
+				}
+				else if (next == '[')
+				{
+					expect('[');
+					if (peek() != ']')
+					{
+						std::size_t index = 0;
+						do
+						{
+							std::map<std::string, std::string> element;
+							readValue("", element);
+
+							auto name = element.find("name");
+							std::string key = name != element.end() ? name->second : std::to_string(index);
+							++index;
+
+							for (const auto& entry : element)
+								values[join(join(path, key), entry.first)] = entry.second;
+						} while (accept(','));
+					}
+					expect(']');
+				}
+				else if (next == '"')
+				{
+					values[path] = readString();
+				}
+				else
+				{
+					//numbers, true, false and null
+					std::size_t start = position_;
+					while (position_ < text_.size() && std::string(",}] \t\r\n").find(text_[position_]) == std::string::npos)
+						++position_;
+
+					if (start == position_)
+						throw std::runtime_error("Baseline is not valid JSON, unexpected character at offset "
+												 + std::to_string(position_));
+
+					values[path] = text_.substr(start, position_ - start);
+				}
+			}
+
+			std::string				readString()
+			{
+				expect('"');
+				std::string result;
+
+				while (position_ < text_.size() && text_[position_] != '"')
+				{
+					if (text_[position_] == '\\')
+						++position_;
+					if (position_ < text_.size())
+						result += text_[position_++];
+				}
+
+				expect('"');
+				return result;
+			}
+
+			void					skipWhitespace()
+			{
+				while (position_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[position_])))
+					++position_;
+			}
+
+			char					peek()
+			{
+				skipWhitespace();
+				return position_ < text_.size() ? text_[position_] : '\0';
+			}
+
+			bool					accept(char c)
+			{
+				if (peek() != c)
+					return false;
+
+				++position_;
+				return true;
+			}
+
+			void					expect(char c)
+			{
+				if (!accept(c))
+					throw std::runtime_error(std::string("Baseline is not valid JSON, expected '") + c
+											 + "' at offset " + std::to_string(position_));
+			}
+
+		private:
+			const std::string&		text_;
+			std::size_t				position_;
+		};
+	}
+
+	void writeReport(std::ostream& out, const std::vector<ScenarioResult>& results)
+	{
+		std::ios::fmtflags flags = out.flags();
+		out << std::fixed << std::setprecision(4);
+
+		out << "{\n  \"unit\": \"ms\",\n  \"scenarios\": [";
+
+		for (std::size_t i = 0; i < results.size(); ++i)
+		{
+			const ScenarioResult& result = results[i];
+
+			out << (i == 0 ? "\n" : ",\n")
+				<< "    {\n"
+				<< "      \"name\": \"" << result.name << "\",\n"
+				<< "      \"ticks\": " << result.ticks << ",\n"
+				<< "      \"playerSurvived\": " << (result.playerSurvived ? "true" : "false") << ",\n"
+				<< "      \"desyncs\": " << result.desyncs << ",\n"
+				<< "      \"overall\": ";
+			writeSummary(out, result.overall);
+			out << ",\n      \"phases\": {";
+
+			for (std::size_t p = 0; p < result.phases.size(); ++p)
+			{
+				out << (p == 0 ? "\n" : ",\n") << "        \"" << result.phases[p].first << "\": ";
+				writeSummary(out, result.phases[p].second);
+			}
+
+			out << "\n      }\n    }";
+		}
+
+		out << "\n  ]\n}\n";
+		out.flags(flags);
+	}
+
+	std::vector<Regression> compareWithBaseline(const std::vector<ScenarioResult>& results,
+												const std::string& baselinePath,
+												double threshold, double minimumDelta)
+	{
+		std::ifstream file(baselinePath);
+		if (!file)
+			throw std::runtime_error("Baseline could not be opened: " + baselinePath);
+
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		std::string text = buffer.str();
+		std::map<std::string, std::string> baseline = BaselineReader(text).read();
+
+		std::vector<Regression> regressions;
+
+		auto check = [&](const std::string& scenario, const std::string& metric, double current)
+		{
+			auto found = baseline.find("scenarios." + scenario + "." + metric);
+			if (found == baseline.end())
+				return;
+
+			double previous = std::strtod(found->second.c_str(), nullptr);
+			if (current > previous * (1.0 + threshold) && current - previous >= minimumDelta)
+				regressions.push_back(Regression{ scenario, metric, previous, current });
+		};
+
+		for (const ScenarioResult& result : results)
+		{
+			check(result.name, "overall.mean", result.overall.mean);
+			check(result.name, "overall.p99", result.overall.p99);
+
+			for (const auto& phase : result.phases)
+			{
+				check(result.name, "phases." + phase.first + ".mean", phase.second.mean);
+				check(result.name, "phases." + phase.first + ".p99", phase.second.p99);
+			}
+		}
+
+		return regressions;
+	}
+}
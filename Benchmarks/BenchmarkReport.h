@@ -0,0 +1,62 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BenchmarkReport
+* Writes benchmark results as JSON and compares them against a baseline
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include "BenchmarkRunner.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace GEX
+{
+	struct Regression
+	{
+		std::string					scenario;
+		std::string					metric;
+		double						baseline;
+		double						current;
+	};
+
+	void							writeReport(std::ostream& out, const std::vector<ScenarioResult>& results);
+
+	//A metric regresses when it is more than threshold (a fraction) above the baseline and
+	//at least minimumDelta milliseconds slower, so timer noise on tiny phases is not reported.
+	//Scenarios missing from the baseline are skipped. Throws std::runtime_error on unreadable baselines.
+	std::vector<Regression>			compareWithBaseline(const std::vector<ScenarioResult>& results,
+														const std::string& baselinePath,
+														double threshold, double minimumDelta);
+}
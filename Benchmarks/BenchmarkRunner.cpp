@@ -0,0 +1,258 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BenchmarkRunner Class
+* Drives a headless World through a scenario and times every tick
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "BenchmarkRunner.h"
+#include "World.h"
+#include "Random.h"
+#include "Replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace GEX
+{
+	namespace
+	{
+		const std::size_t PHASE_COUNT = static_cast<std::size_t>(World::UpdatePhase::Count);
+
+		const char* toString(World::UpdatePhase phase)
+		{
+			switch (phase)
+			{
+				case World::UpdatePhase::Commands:
+					return "commands";
+				case World::UpdatePhase::Collision:
+					return "collision";
+				case World::UpdatePhase::Spawning:
+					return "spawning";
+				case World::UpdatePhase::Movement:
+					return "movement";
+				case World::UpdatePhase::Presentation:
+					return "presentation";
+				case World::UpdatePhase::Steering:
+					return "steering";
+				default:
+					return "unknown";
+			}
+		}
+
+		//Nearest rank percentile of an already sorted sample set
+		double percentile(const std::vector<double>& sorted, double fraction)
+		{
+			std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * sorted.size()));
+			return sorted[std::max<std::size_t>(rank, 1) - 1];
+		}
+
+		struct PhaseSamples
+		{
+			std::vector<double>					ticks;
+			std::vector<std::vector<double>>	phases;
+		};
+
+		//Times one world update and keeps the per phase split
+		void timeUpdate(World& world, sf::Time dt, PhaseSamples* samples)
+		{
+			auto start = std::chrono::steady_clock::now();
+			world.update(dt, world.getCommandQueue());
+			auto elapsed = std::chrono::steady_clock::now() - start;
+
+			if (!samples)
+				return;
+
+			samples->ticks.push_back(std::chrono::duration<double, std::milli>(elapsed).count());
+			for (std::size_t phase = 0; phase < PHASE_COUNT; ++phase)
+			{
+				sf::Time time = world.getPhaseTime(static_cast<World::UpdatePhase>(phase));
+				samples->phases[phase].push_back(time.asMicroseconds() / 1000.0);
+			}
+		}
+
+		ScenarioResult makeResult(const std::string& name, const World& world, const PhaseSamples& samples)
+		{
+			ScenarioResult result;
+			result.name = name;
+			result.ticks = samples.ticks.size();
+			result.playerSurvived = world.hasAlivePlayer();
+			result.desyncs = 0;
+			result.overall = summarize(samples.ticks);
+
+			for (std::size_t phase = 0; phase < PHASE_COUNT; ++phase)
+				result.phases.emplace_back(toString(static_cast<World::UpdatePhase>(phase)), summarize(samples.phases[phase]));
+
+			return result;
+		}
+
+		//Keeps the player alive and armed so every tick measures the same kind of work
+		Command makeUpkeepCommand()
+		{
+			Command upkeep;
+			upkeep.category = Category::Type::Player;
+			upkeep.action = derivedAction<Player>([](Player& player, sf::Time)
+			{
+				if (player.getHitpoints() > 0 && player.getHitpoints() < 100)
+					player.repair(100 - player.getHitpoints());
+
+				player.collectAmmo(1);
+			});
+
+			return upkeep;
+		}
+
+		Command makeFireCommand()
+		{
+			Command fire;
+			fire.category = Category::Type::Player;
+			fire.action = derivedAction<Player>([](Player& player, sf::Time)
+			{
+				player.fire();
+			});
+
+			return fire;
+		}
+
+		//A point just outside the world, where the game's own spawn points sit
+		sf::Vector2f edgePosition(const sf::FloatRect& bounds, Random& rng)
+		{
+			const float OFFSET = 50.f;
+			float t = rng.nextFloat();
+
+			switch (rng.nextInt(4))
+			{
+				case 0:
+					return sf::Vector2f(bounds.left - OFFSET, bounds.top + t * bounds.height);
+				case 1:
+					return sf::Vector2f(bounds.left + bounds.width + OFFSET, bounds.top + t * bounds.height);
+				case 2:
+					return sf::Vector2f(bounds.left + t * bounds.width, bounds.top - OFFSET);
+				default:
+					return sf::Vector2f(bounds.left + t * bounds.width, bounds.top + bounds.height + OFFSET);
+			}
+		}
+	}
+
+	TimingSummary summarize(std::vector<double> samples)
+	{
+		TimingSummary summary = {};
+		if (samples.empty())
+			return summary;
+
+		std::sort(samples.begin(), samples.end());
+
+		summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+		summary.p50 = percentile(samples, 0.50);
+		summary.p99 = percentile(samples, 0.99);
+		summary.max = samples.back();
+
+		return summary;
+	}
+
+	BenchmarkRunner::BenchmarkRunner(sf::Time timePerTick, sf::Vector2f viewSize)
+	: timePerTick_(timePerTick)
+	, viewSize_(viewSize)
+	{
+	}
+
+	ScenarioResult BenchmarkRunner::run(const Scenario& scenario) const
+	{
+		//A substream, so the layout does not draw the same numbers as the world's own stream
+		Random rng = Random(scenario.seed).substream(0);
+
+		World world(viewSize_, scenario.seed);
+		world.setEnemySpawning(false);
+
+		const sf::FloatRect bounds = world.getWorldBounds();
+		for (std::size_t i = 0; i < scenario.pickups; ++i)
+		{
+			float x = rng.nextFloat(bounds.left, bounds.left + bounds.width);
+			float y = rng.nextFloat(bounds.top, bounds.top + bounds.height);
+			world.spawnPickup(Pickup::Type::AmmoRefill, sf::Vector2f(x, y));
+		}
+
+		const std::size_t warmupTicks = static_cast<std::size_t>(scenario.warmup / timePerTick_);
+		const std::size_t measuredTicks = static_cast<std::size_t>(scenario.duration / timePerTick_);
+
+		PhaseSamples samples;
+		samples.phases.resize(PHASE_COUNT);
+
+		samples.ticks.reserve(measuredTicks);
+		for (auto& times : samples.phases)
+			times.reserve(measuredTicks);
+
+		float pendingShots = 0.f;
+
+		for (std::size_t tick = 0; tick < warmupTicks + measuredTicks && world.hasAlivePlayer(); ++tick)
+		{
+			while (world.getAliveZombieCount() < scenario.zombies)
+				world.spawnZombie(Zombie::ZombieType::Zombie, edgePosition(bounds, rng));
+
+			CommandQueue& commands = world.getCommandQueue();
+			commands.push(makeUpkeepCommand());
+
+			pendingShots += scenario.fireRate * timePerTick_.asSeconds();
+			for (; pendingShots >= 1.f; pendingShots -= 1.f)
+				commands.push(makeFireCommand());
+
+			timeUpdate(world, timePerTick_, tick < warmupTicks ? nullptr : &samples);
+		}
+
+		return makeResult(scenario.name, world, samples);
+	}
+
+	ScenarioResult BenchmarkRunner::runReplay(const std::string& path) const
+	{
+		ReplayPlayer replay(path);
+		World world(viewSize_, replay.getSeed());
+
+		PhaseSamples samples;
+		samples.phases.resize(PHASE_COUNT);
+		std::size_t desyncs = 0;
+
+		while (!replay.isFinished())
+		{
+			if (replay.hasKeyframe() && replay.getKeyframeChecksum() != world.computeChecksum())
+				++desyncs;
+
+			replay.feed(world.getCommandQueue());
+			timeUpdate(world, replay.getTimePerTick(), &samples);
+		}
+
+		ScenarioResult result = makeResult(path, world, samples);
+		result.desyncs = desyncs;
+
+		return result;
+	}
+}
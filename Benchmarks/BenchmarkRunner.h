@@ -0,0 +1,85 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BenchmarkRunner Class
+* Drives a headless World through a scenario and times every tick
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include "Scenario.h"
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace GEX
+{
+	// Tick time distribution, all values in milliseconds
+	struct TimingSummary
+	{
+		double						mean;
+		double						p50;
+		double						p99;
+		double						max;
+	};
+
+	TimingSummary					summarize(std::vector<double> samples);
+
+	struct ScenarioResult
+	{
+		std::string					name;
+		std::size_t					ticks;
+		bool						playerSurvived;
+		std::size_t					desyncs;		// replays only, keyframes whose checksum differed
+		TimingSummary				overall;
+		std::vector<std::pair<std::string, TimingSummary>>	phases;
+	};
+
+	class BenchmarkRunner
+	{
+	public:
+		explicit					BenchmarkRunner(sf::Time timePerTick = sf::seconds(1.f / 60.f),
+													sf::Vector2f viewSize = sf::Vector2f(1680.f, 1050.f));
+
+		ScenarioResult				run(const Scenario& scenario) const;
+
+			//plays a recorded game at its own seed and tick length, checking every keyframe checksum
+		ScenarioResult				runReplay(const std::string& path) const;
+
+	private:
+		sf::Time					timePerTick_;
+		sf::Vector2f				viewSize_;
+	};
+}
@@ -0,0 +1,151 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* MicroBenchmark Class
+* Times small kernels over a sweep of problem sizes, with allocation counts
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "MicroBenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+namespace
+{
+	std::atomic<std::size_t> allocationCount(0);
+}
+
+// Replacing the global allocator is how allocations per op are counted, which
+// is why this file only ever links into the micro benchmark executable
+void* operator new(std::size_t size)
+{
+	++allocationCount;
+
+	if (void* block = std::malloc(size == 0 ? 1 : size))
+		return block;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+	std::free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept
+{
+	std::free(block);
+}
+
+namespace GEX
+{
+	std::size_t getAllocationCount()
+	{
+		return allocationCount.load();
+	}
+
+	MicroBenchmark::MicroBenchmark(std::chrono::milliseconds minimumTime)
+	: minimumTime_(minimumTime)
+	, entries_()
+	{
+	}
+
+	void MicroBenchmark::add(const std::string& name, std::vector<std::size_t> sizes, Factory factory)
+	{
+		entries_.push_back(Entry{ name, std::move(sizes), std::move(factory) });
+	}
+
+	std::vector<MicroBenchmarkResult> MicroBenchmark::run(const std::string& filter, std::ostream& out) const
+	{
+		std::vector<MicroBenchmarkResult> results;
+
+		out << std::left << std::setw(40) << "benchmark" << std::right
+			<< std::setw(8) << "size"
+			<< std::setw(12) << "iterations"
+			<< std::setw(16) << "ns/op"
+			<< std::setw(14) << "allocs/op" << "\n";
+
+		for (const Entry& entry : entries_)
+		{
+			if (entry.name.find(filter) == std::string::npos)
+				continue;
+
+			for (std::size_t size : entry.sizes)
+			{
+				MicroBenchmarkResult result = measure(entry, size);
+				results.push_back(result);
+
+				out << std::left << std::setw(40) << result.name << std::right
+					<< std::setw(8) << result.size
+					<< std::setw(12) << result.iterations
+					<< std::setw(16) << std::fixed << std::setprecision(1) << result.nanosecondsPerOp
+					<< std::setw(14) << std::setprecision(2) << result.allocationsPerOp << "\n" << std::flush;
+			}
+		}
+
+		return results;
+	}
+
+	//Grows the iteration count until one run lasts at least the minimum time and reports that run
+	MicroBenchmarkResult MicroBenchmark::measure(const Entry& entry, std::size_t size) const
+	{
+		using Clock = std::chrono::steady_clock;
+
+		Kernel kernel = entry.factory(size);
+		std::size_t iterations = 1;
+
+		for (;;)
+		{
+			std::size_t allocationsBefore = getAllocationCount();
+			Clock::time_point start = Clock::now();
+
+			kernel(iterations);
+
+			std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+			std::size_t allocations = getAllocationCount() - allocationsBefore;
+
+			if (elapsed >= minimumTime_)
+			{
+				return MicroBenchmarkResult{ entry.name, size, iterations,
+											 elapsed.count() / iterations,
+											 static_cast<double>(allocations) / iterations };
+			}
+
+			//aim a little past the minimum, but never more than ten times further
+			double target = std::chrono::duration<double, std::nano>(minimumTime_).count() * 1.2;
+			double scale = elapsed.count() > 0.0 ? target / elapsed.count() : 10.0;
+			iterations = static_cast<std::size_t>(iterations * std::min(std::max(scale, 2.0), 10.0));
+		}
+	}
+}
@@ -0,0 +1,106 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* MicroBenchmark Class
+* Times small kernels over a sweep of problem sizes, with allocation counts
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace GEX
+{
+	//global operator new calls made by this process so far
+	std::size_t						getAllocationCount();
+
+	//keeps the optimizer from discarding a value the benchmark computed
+	template <typename T>
+	inline void						doNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "g"(&value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+		_ReadWriteBarrier();
+#endif
+	}
+
+	struct MicroBenchmarkResult
+	{
+		std::string					name;
+		std::size_t					size;
+		std::size_t					iterations;
+		double						nanosecondsPerOp;
+		double						allocationsPerOp;
+	};
+
+	class MicroBenchmark
+	{
+	public:
+		//performs the given number of operations on state prepared by the factory, one operation
+		//covers the whole problem size (every node, every command in the batch, ...)
+		using Kernel = std::function<void(std::size_t iterations)>;
+		using Factory = std::function<Kernel(std::size_t size)>;
+
+	public:
+		explicit					MicroBenchmark(std::chrono::milliseconds minimumTime);
+
+		void						add(const std::string& name, std::vector<std::size_t> sizes, Factory factory);
+
+			//runs every benchmark whose name contains filter, printing each result as it finishes
+		std::vector<MicroBenchmarkResult>	run(const std::string& filter, std::ostream& out) const;
+
+	private:
+		struct Entry
+		{
+			std::string				name;
+			std::vector<std::size_t>	sizes;
+			Factory					factory;
+		};
+
+	private:
+		MicroBenchmarkResult		measure(const Entry& entry, std::size_t size) const;
+
+	private:
+		std::chrono::milliseconds	minimumTime_;
+		std::vector<Entry>			entries_;
+	};
+}
@@ -0,0 +1,586 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Micro benchmark entry point
+* Engine hot kernels swept over problem sizes, reported as ns/op and allocs/op
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "MicroBenchmark.h"
+
+#include "Animation.h"
+#include "AnimationClip.h"
+#include "CommandQueue.h"
+#include "CommandStaging.h"
+#include "DataTables.h"
+#include "FlowField.h"
+#include "NodePool.h"
+#include "ParticleNode.h"
+#include "Random.h"
+#include "SceneNode.h"
+#include "SpatialHashGrid.h"
+#include "TextureManager.h"
+#include "Utility.h"
+#include "Zombie.h"
+#include "ZombieHorde.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace
+{
+	const std::vector<std::size_t> BATCH_SIZES = { 1, 64, 4096 };
+
+	// A plain node with a fixed 32x32 box, the size of a zombie's collision box
+	class BoxNode : public GEX::SceneNode
+	{
+	protected:
+		sf::FloatRect computeBoundingBox() const override
+		{
+			return getWorldTransform().transformRect(sf::FloatRect(0.f, 0.f, 32.f, 32.f));
+		}
+	};
+
+	//Scatters nodes over an area that grows with the count so the overlap density stays the same
+	std::unique_ptr<GEX::SceneNode> scatterBoxes(std::size_t count)
+	{
+		GEX::Random rng(1);
+		float side = 64.f * std::sqrt(static_cast<float>(count));
+
+		std::unique_ptr<GEX::SceneNode> root(new GEX::SceneNode());
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			std::unique_ptr<BoxNode> box(new BoxNode());
+			box->setPosition(rng.nextFloat(0.f, side), rng.nextFloat(0.f, side));
+			root->attachChild(std::move(box));
+		}
+
+		return root;
+	}
+
+	//The zombie sheets and clips a Zombie needs to construct, sizes only
+	void loadZombieTextures(GEX::TextureManager& textures)
+	{
+		textures.load(GEX::TextureID::Zombie, "Media/Textures/zombie.png");
+		textures.load(GEX::TextureID::ZombieWalkUp, "Media/Textures/zombie_walk_up.png");
+		textures.load(GEX::TextureID::ZombieWalkLeft, "Media/Textures/zombie_walk_left.png");
+		textures.load(GEX::TextureID::ZombieWalkDown, "Media/Textures/zombie_walk_down.png");
+		textures.load(GEX::TextureID::ZombieWalkRight, "Media/Textures/zombie_walk_right.png");
+		textures.load(GEX::TextureID::ZombieDeath, "Media/Textures/zombie_death.png");
+
+		const std::set<GEX::AnimationID> zombieClips = {
+			GEX::AnimationID::ZombieWalkUp,
+			GEX::AnimationID::ZombieWalkLeft,
+			GEX::AnimationID::ZombieWalkDown,
+			GEX::AnimationID::ZombieWalkRight,
+			GEX::AnimationID::ZombieDeath
+		};
+
+		for (const auto& pair : GEX::initializeAnimationData())
+		{
+			const GEX::AnimationData& clip = pair.second;
+			if (zombieClips.count(pair.first) > 0)
+				textures.loadClip(pair.first, clip.texture, clip.frameSize, clip.numFrames, clip.duration, clip.repeat);
+		}
+	}
+
+	// Zombies and the horde they belong to, declared so the zombies leave the horde before it goes
+	struct Crowd
+	{
+		Crowd()
+		: textures(GEX::TextureManager::Mode::Headless)
+		, random(1)
+		, horde()
+		, zombies()
+		{
+			loadZombieTextures(textures);
+		}
+
+		GEX::TextureManager							textures;
+		GEX::Random									random;
+		GEX::ZombieHorde							horde;
+		std::vector<std::unique_ptr<GEX::Zombie>>	zombies;
+	};
+
+	void addAnimation(GEX::MicroBenchmark& suite)
+	{
+		suite.add("Animation::update", BATCH_SIZES, [](std::size_t size)
+		{
+			//an 8 frame walk cycle laid out on one row, no texture needed to step through it
+			sf::Sprite sheet;
+			sheet.setTextureRect(sf::IntRect(0, 0, 8 * 45, 45));
+
+			auto animations = std::make_shared<std::vector<GEX::Animation>>(size, GEX::Animation(sheet));
+			for (GEX::Animation& animation : *animations)
+			{
+				animation.setFrameSize(sf::Vector2i(45, 45));
+				animation.setNumFrames(8);
+				animation.setDuration(sf::seconds(1.f));
+				animation.setRepeating(true);
+			}
+
+			return [animations](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (GEX::Animation& animation : *animations)
+						animation.update(sf::seconds(1.f / 60.f));
+				}
+				GEX::doNotOptimize(animations->front().getSprite().getTextureRect());
+			};
+		});
+
+		suite.add("AnimationClip::getFrameAt", BATCH_SIZES, [](std::size_t size)
+		{
+			//the same walk cycle as one shared clip, each instance only has its time into the clip
+			auto clip = std::make_shared<GEX::AnimationClip>(nullptr, sf::IntRect(0, 0, 8 * 45, 45), sf::Vector2i(45, 45), 8, sf::seconds(1.f), true);
+			auto times = std::make_shared<std::vector<sf::Time>>(size);
+			for (std::size_t i = 0; i < size; ++i)
+				(*times)[i] = sf::milliseconds(static_cast<int>(i * 37 % 5000));
+
+			return [clip, times](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (sf::Time& time : *times)
+					{
+						time += sf::seconds(1.f / 60.f);
+						GEX::doNotOptimize(clip->getFrameAt(time));
+					}
+				}
+			};
+		});
+	}
+
+	void addWorldTransform(GEX::MicroBenchmark& suite)
+	{
+		auto buildChain = [](std::size_t depth, GEX::SceneNode*& leaf)
+		{
+			std::unique_ptr<GEX::SceneNode> root(new GEX::SceneNode());
+			leaf = root.get();
+
+			for (std::size_t i = 1; i < depth; ++i)
+			{
+				std::unique_ptr<GEX::SceneNode> child(new GEX::SceneNode());
+				child->setPosition(1.f, 1.f);
+				GEX::SceneNode* next = child.get();
+				leaf->attachChild(std::move(child));
+				leaf = next;
+			}
+
+			return std::shared_ptr<GEX::SceneNode>(std::move(root));
+		};
+
+		suite.add("SceneNode::getWorldTransform cached", { 1, 8, 64, 512 }, [buildChain](std::size_t depth)
+		{
+			GEX::SceneNode* leaf = nullptr;
+			auto root = buildChain(depth, leaf);
+
+			return [root, leaf](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+					GEX::doNotOptimize(leaf->getWorldTransform());
+			};
+		});
+
+		//moving the root dirties the whole chain, so every call recomputes depth transforms
+		suite.add("SceneNode::getWorldTransform after move", { 1, 8, 64, 512 }, [buildChain](std::size_t depth)
+		{
+			GEX::SceneNode* leaf = nullptr;
+			auto root = buildChain(depth, leaf);
+
+			return [root, leaf](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					root->move(0.001f, 0.f);
+					GEX::doNotOptimize(leaf->getWorldTransform());
+				}
+			};
+		});
+	}
+
+	void addCollision(GEX::MicroBenchmark& suite)
+	{
+		const std::vector<std::size_t> nodeCounts = { 10, 100, 1000, 10000 };
+
+		suite.add("SceneNode::checkSceneCollision", nodeCounts, [](std::size_t count)
+		{
+			std::shared_ptr<GEX::SceneNode> root = scatterBoxes(count);
+
+			return [root](std::size_t iterations)
+			{
+				std::set<GEX::SceneNode::Pair> pairs;
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					pairs.clear();
+					root->checkSceneCollision(*root, pairs);
+				}
+				GEX::doNotOptimize(pairs.size());
+			};
+		});
+
+		//the broad phase World uses in its place
+		suite.add("SpatialHashGrid insert + findPairs", nodeCounts, [](std::size_t count)
+		{
+			std::shared_ptr<GEX::SceneNode> root = scatterBoxes(count);
+			auto grid = std::make_shared<GEX::SpatialHashGrid>(64.f);
+
+			return [root, grid](std::size_t iterations)
+			{
+				std::set<GEX::SceneNode::Pair> pairs;
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					pairs.clear();
+					grid->clear();
+					root->insertIntoGrid(*grid);
+					grid->findPairs(pairs);
+				}
+				GEX::doNotOptimize(pairs.size());
+			};
+		});
+	}
+
+	void addCommandQueue(GEX::MicroBenchmark& suite)
+	{
+		suite.add("CommandQueue push/pop + derivedAction", BATCH_SIZES, [](std::size_t size)
+		{
+			auto target = std::make_shared<BoxNode>();
+			auto queue = std::make_shared<GEX::CommandQueue>();
+			auto hits = std::make_shared<std::size_t>(0);
+
+			return [target, queue, hits, size](std::size_t iterations)
+			{
+				std::size_t* counter = hits.get();
+
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (std::size_t c = 0; c < size; ++c)
+					{
+						GEX::Command command;
+						command.category = Category::Type::None;
+						command.action = GEX::derivedAction<BoxNode>([counter](BoxNode&, sf::Time)
+						{
+							++*counter;
+						});
+						queue->push(std::move(command));
+					}
+
+					while (!queue->isEmpty())
+					{
+						queue->front().action(*target, sf::Time::Zero);
+						queue->pop();
+					}
+				}
+				GEX::doNotOptimize(*hits);
+			};
+		});
+
+		suite.add("CommandStaging push + merge, 4 lanes", BATCH_SIZES, [](std::size_t size)
+		{
+			auto target = std::make_shared<BoxNode>();
+			auto staging = std::make_shared<GEX::CommandStaging>(4);
+			auto queue = std::make_shared<GEX::CommandQueue>();
+			auto hits = std::make_shared<std::size_t>(0);
+
+			return [target, staging, queue, hits, size](std::size_t iterations)
+			{
+				std::size_t* counter = hits.get();
+
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (std::size_t c = 0; c < size; ++c)
+					{
+						GEX::Command command;
+						command.category = Category::Type::None;
+						command.action = GEX::derivedAction<BoxNode>([counter](BoxNode&, sf::Time)
+						{
+							++*counter;
+						});
+						staging->getLane(c % staging->getLaneCount()).push(std::move(command));
+					}
+
+					staging->mergeInto(*queue);
+
+					while (!queue->isEmpty())
+					{
+						queue->front().action(*target, sf::Time::Zero);
+						queue->pop();
+					}
+				}
+				GEX::doNotOptimize(*hits);
+			};
+		});
+	}
+
+	void addSpawning(GEX::MicroBenchmark& suite)
+	{
+		//a whole wave of zombies joins the horde and the layer, then dies; once the pool and the
+		//containers have grown to the wave size, a steady state wave should not touch the heap
+		suite.add("Zombie spawn + despawn", { 1, 64, 256 }, [](std::size_t size)
+		{
+			auto textures = std::make_shared<GEX::TextureManager>(GEX::TextureManager::Mode::Headless);
+			loadZombieTextures(*textures);
+
+			GEX::NodePool<GEX::Zombie>::getInstance().reserve(size);
+
+			auto random = std::make_shared<GEX::Random>(1);
+			auto layer = std::make_shared<GEX::SceneNode>();
+			auto horde = std::make_shared<GEX::ZombieHorde>();
+			auto spawned = std::make_shared<std::vector<GEX::Zombie*>>();
+			spawned->reserve(size);
+
+			return [textures, random, layer, horde, spawned, size](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (std::size_t n = 0; n < size; ++n)
+					{
+						std::unique_ptr<GEX::Zombie> zombie(new GEX::Zombie(GEX::Zombie::ZombieType::Zombie, *textures, *random));
+						zombie->setPosition(static_cast<float>(n % 16) * 40.f, static_cast<float>(n / 16) * 40.f);
+						horde->add(*zombie);
+						spawned->push_back(zombie.get());
+						layer->attachChild(std::move(zombie));
+					}
+
+					//newest first, the way the pool hands blocks back out
+					while (!spawned->empty())
+					{
+						layer->detachChild(*spawned->back());
+						spawned->pop_back();
+					}
+				}
+				GEX::doNotOptimize(GEX::NodePool<GEX::Zombie>::getInstance().getHighWaterMark());
+			};
+		});
+	}
+
+	void addCrowds(GEX::MicroBenchmark& suite)
+	{
+		//the same 1024 zombies packed into fewer radius wide cells as the size grows, the capped
+		//scan should keep the time per call flat however many zombies share each cell
+		suite.add("ZombieHorde::separate 1024, per cell", { 1, 4, 16, 64 }, [](std::size_t perCell)
+		{
+			const std::size_t COUNT = 1024;
+			const float RADIUS = 40.f;
+
+			auto crowd = std::make_shared<Crowd>();
+			float side = RADIUS * std::sqrt(static_cast<float>(COUNT) / perCell);
+
+			for (std::size_t n = 0; n < COUNT; ++n)
+			{
+				std::unique_ptr<GEX::Zombie> zombie(new GEX::Zombie(GEX::Zombie::ZombieType::Zombie, crowd->textures, crowd->random));
+				zombie->setPosition(crowd->random.nextFloat(0.f, side), crowd->random.nextFloat(0.f, side));
+				crowd->horde.add(*zombie);
+				crowd->zombies.push_back(std::move(zombie));
+			}
+
+			return [crowd, RADIUS](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+					crowd->horde.separate(RADIUS, 32);
+
+				GEX::doNotOptimize(crowd->horde.getVelocity(0));
+			};
+		});
+	}
+
+	void addParticles(GEX::MicroBenchmark& suite)
+	{
+		suite.add("ParticleNode::computeVertices", { 16, 256, 4096 }, [](std::size_t size)
+		{
+			auto textures = std::make_shared<GEX::TextureManager>(GEX::TextureManager::Mode::Headless);
+			textures->load(GEX::TextureID::Particle, "Media/Textures/Particle.png");
+
+			auto node = std::make_shared<GEX::ParticleNode>(GEX::Particle::Type::Smoke, *textures);
+			for (std::size_t i = 0; i < size; ++i)
+				node->addParticle(sf::Vector2f(static_cast<float>(i % 64), static_cast<float>(i / 64)));
+
+			auto commands = std::make_shared<GEX::CommandQueue>();
+
+			//a zero length update only marks the vertices stale, the rebuild dominates
+			return [textures, node, commands](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					node->update(sf::Time::Zero, *commands);
+					GEX::doNotOptimize(node->getVertices().getVertexCount());
+				}
+			};
+		});
+	}
+
+	void addPathing(GEX::MicroBenchmark& suite)
+	{
+		//The game's field: the 1680x1050 world plus its spawn margin, in 32 px cells
+		const sf::FloatRect AREA(-64.f, -64.f, 1808.f, 1178.f);
+
+		suite.add("FlowField rebuild", { 1 }, [AREA](std::size_t)
+		{
+			auto field = std::make_shared<GEX::FlowField>(AREA, 32.f);
+
+			return [field](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					//alternate cells so every update rebuilds
+					GEX::doNotOptimize(field->update(sf::Vector2f(i % 2 == 0 ? 200.f : 900.f, 500.f)));
+				}
+			};
+		});
+
+		suite.add("FlowField lookup", BATCH_SIZES, [AREA](std::size_t size)
+		{
+			auto field = std::make_shared<GEX::FlowField>(AREA, 32.f);
+			field->update(sf::Vector2f(840.f, 525.f));
+
+			GEX::Random rng(1);
+			auto positions = std::make_shared<std::vector<sf::Vector2f>>();
+			for (std::size_t n = 0; n < size; ++n)
+				positions->emplace_back(rng.nextFloat(AREA.left, AREA.left + AREA.width), rng.nextFloat(AREA.top, AREA.top + AREA.height));
+
+			return [field, positions](std::size_t iterations)
+			{
+				float sum = 0.f;
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (const sf::Vector2f& position : *positions)
+					{
+						sf::Vector2f direction = field->getDirection(position);
+						sum += direction.x + direction.y;
+					}
+				}
+				GEX::doNotOptimize(sum);
+			};
+		});
+	}
+
+	void addUtility(GEX::MicroBenchmark& suite)
+	{
+		suite.add("Random::nextInt", BATCH_SIZES, [](std::size_t size)
+		{
+			auto random = std::make_shared<GEX::Random>(1);
+
+			return [size, random](std::size_t iterations)
+			{
+				int sum = 0;
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (std::size_t n = 0; n < size; ++n)
+						sum += random->nextInt(100);
+				}
+				GEX::doNotOptimize(sum);
+			};
+		});
+
+		suite.add("Random::fillInts", BATCH_SIZES, [](std::size_t size)
+		{
+			auto random = std::make_shared<GEX::Random>(1);
+			auto values = std::make_shared<std::vector<int>>(size);
+
+			return [random, values](std::size_t iterations)
+			{
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					random->fillInts(values->data(), values->size(), 100);
+					GEX::doNotOptimize(values->back());
+				}
+			};
+		});
+
+		suite.add("unitVector + length", BATCH_SIZES, [](std::size_t size)
+		{
+			auto vectors = std::make_shared<std::vector<sf::Vector2f>>();
+			for (std::size_t n = 0; n < size; ++n)
+				vectors->emplace_back(3.f + n, 4.f - n);
+
+			return [vectors](std::size_t iterations)
+			{
+				float sum = 0.f;
+				for (std::size_t i = 0; i < iterations; ++i)
+				{
+					for (const sf::Vector2f& vector : *vectors)
+						sum += GEX::length(GEX::unitVector(vector)) + GEX::length(vector);
+				}
+				GEX::doNotOptimize(sum);
+			};
+		});
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::string filter;
+	long minimumTime = 100;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string arg = argv[i];
+
+		if (arg == "--filter")
+			filter = argv[i + 1];
+		else if (arg == "--min-time")
+			minimumTime = std::atol(argv[i + 1]);
+	}
+
+	if (argc % 2 == 0)
+	{
+		std::cerr << "usage: BoxheadMicroBenchmark [--filter <substring>] [--min-time <ms>]\n"
+				  << "Run from the game folder so Media/ resolves.\n";
+		return EXIT_FAILURE;
+	}
+
+	GEX::MicroBenchmark suite{ std::chrono::milliseconds(minimumTime) };
+
+	addAnimation(suite);
+	addWorldTransform(suite);
+	addCollision(suite);
+	addCommandQueue(suite);
+	addSpawning(suite);
+	addCrowds(suite);
+	addParticles(suite);
+	addPathing(suite);
+	addUtility(suite);
+
+	try
+	{
+		suite.run(filter, std::cout);
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << "\n";
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
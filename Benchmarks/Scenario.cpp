@@ -0,0 +1,140 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Scenario
+* Benchmark scenario definitions and their loader
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "Scenario.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace GEX
+{
+	namespace
+	{
+		std::string trim(const std::string& text)
+		{
+			const char* whitespace = " \t\r\n";
+			std::size_t first = text.find_first_not_of(whitespace);
+
+			if (first == std::string::npos)
+				return std::string();
+
+			std::size_t last = text.find_last_not_of(whitespace);
+			return text.substr(first, last - first + 1);
+		}
+
+		template <typename T>
+		T parseValue(const std::string& value, const std::string& where)
+		{
+			std::istringstream stream(value);
+			T result;
+
+			if (!(stream >> result) || !(stream >> std::ws).eof())
+				throw std::runtime_error(where + ": bad value '" + value + "'");
+
+			return result;
+		}
+	}
+
+	Scenario::Scenario()
+	: name()
+	, zombies(0)
+	, fireRate(0.f)
+	, pickups(0)
+	, warmup(sf::seconds(1.f))
+	, duration(sf::seconds(10.f))
+	, seed(1)
+	{
+	}
+
+	std::vector<Scenario> loadScenarios(const std::string& path)
+	{
+		std::ifstream file(path);
+		if (!file)
+			throw std::runtime_error("Scenario file could not be opened: " + path);
+
+		std::vector<Scenario> scenarios;
+		std::string line;
+		int lineNumber = 0;
+
+		while (std::getline(file, line))
+		{
+			++lineNumber;
+			std::string where = path + ":" + std::to_string(lineNumber);
+
+			line = trim(line.substr(0, line.find('#')));
+			if (line.empty())
+				continue;
+
+			if (line.front() == '[')
+			{
+				if (line.back() != ']' || line.size() < 3)
+					throw std::runtime_error(where + ": bad section header '" + line + "'");
+
+				scenarios.emplace_back();
+				scenarios.back().name = trim(line.substr(1, line.size() - 2));
+				continue;
+			}
+
+			std::size_t equals = line.find('=');
+			if (equals == std::string::npos)
+				throw std::runtime_error(where + ": expected key = value");
+
+			if (scenarios.empty())
+				throw std::runtime_error(where + ": setting outside of a [scenario] section");
+
+			std::string key = trim(line.substr(0, equals));
+			std::string value = trim(line.substr(equals + 1));
+			Scenario& scenario = scenarios.back();
+
+			if (key == "zombies")
+				scenario.zombies = parseValue<std::size_t>(value, where);
+			else if (key == "fireRate")
+				scenario.fireRate = parseValue<float>(value, where);
+			else if (key == "pickups")
+				scenario.pickups = parseValue<std::size_t>(value, where);
+			else if (key == "warmup")
+				scenario.warmup = sf::seconds(parseValue<float>(value, where));
+			else if (key == "duration")
+				scenario.duration = sf::seconds(parseValue<float>(value, where));
+			else if (key == "seed")
+				scenario.seed = parseValue<unsigned int>(value, where);
+			else
+				throw std::runtime_error(where + ": unknown key '" + key + "'");
+		}
+
+		return scenarios;
+	}
+}
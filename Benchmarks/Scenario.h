@@ -0,0 +1,61 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Scenario
+* Benchmark scenario definitions and their loader
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <string>
+#include <vector>
+
+namespace GEX
+{
+	// One benchmark setup, read from a [name] section of a scenario file
+	struct Scenario
+	{
+									Scenario();
+
+		std::string					name;
+		std::size_t					zombies;		//alive zombies kept on the field
+		float						fireRate;		//fire orders per second, the player's fire interval still applies
+		std::size_t					pickups;		//pickups scattered before the first tick
+		sf::Time					warmup;			//simulated before measuring starts
+		sf::Time					duration;		//simulated while measuring
+		unsigned int				seed;			//seeds the World and every spawn position the runner picks
+	};
+
+	//throws std::runtime_error on unreadable files, unknown keys and bad values
+	std::vector<Scenario>			loadScenarios(const std::string& path);
+}
@@ -41,6 +41,7 @@ namespace GEX
 { 
 	Animation::Animation()
 		: sprite_()
+		, sheet_()
 		, frameSize_()
 		, numberOfFrames_(0)
 		, currentFrame_(0)
@@ -51,7 +52,25 @@ namespace GEX
 	}
 
 	Animation::Animation(const sf::Texture & texture)
-		: sprite_(texture)
+		: Animation(texture, sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y))
+	{
+	}
+
+	Animation::Animation(const sf::Texture& texture, const sf::IntRect& sheet)
+		: sprite_(texture, sheet)
+		, sheet_(sheet)
+		, frameSize_()
+		, numberOfFrames_(0)
+		, currentFrame_(0)
+		, duration_(sf::Time::Zero)
+		, elapsedTime_(sf::Time::Zero)
+		, repeat_(false)
+	{
+	}
+
+	Animation::Animation(const sf::Sprite& sheet)
+		: sprite_(sheet)
+		, sheet_(sheet.getTextureRect())
 		, frameSize_()
 		, numberOfFrames_(0)
 		, currentFrame_(0)
@@ -62,8 +81,15 @@ namespace GEX
 	}
 
 	void Animation::setTexture(const sf::Texture & texture)
+	{
+		setTexture(texture, sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y));
+	}
+
+	void Animation::setTexture(const sf::Texture& texture, const sf::IntRect& sheet)
 	{
 		sprite_.setTexture(texture);
+		sprite_.setTextureRect(sheet);
+		sheet_ = sheet;
 	}
 
 	const sf::Texture * Animation::getTexture() const
@@ -136,11 +162,11 @@ namespace GEX
 		sf::Time timePerFrame = duration_ / static_cast<float>(numberOfFrames_);
 		elapsedTime_ += dt;
 
-		sf::Vector2i textureBounds(sprite_.getTexture()->getSize());
+		const sf::IntRect firstFrame(sheet_.left, sheet_.top, frameSize_.x, frameSize_.y);
 		sf::IntRect	 textureRect = sprite_.getTextureRect();
 
 		if (currentFrame_ == 0)
-			textureRect = sf::IntRect(0, 0, frameSize_.x, frameSize_.y);
+			textureRect = firstFrame;
 
 		// While a frame is waiting to process
 		while (elapsedTime_ >= timePerFrame && (currentFrame_ <= numberOfFrames_ || repeat_))
@@ -148,11 +174,11 @@ namespace GEX
 			// Move to next frame
 			textureRect.left += textureRect.width;
 
-			// If end of texture is reached
-			if (textureRect.left + textureRect.width > textureBounds.x)
+			// If end of the sheet is reached
+			if (textureRect.left + textureRect.width > sheet_.left + sheet_.width)
 			{
 				// Move down one line
-				textureRect.left = 0;
+				textureRect.left = sheet_.left;
 				textureRect.top += textureRect.height;
 			}
 
@@ -163,7 +189,7 @@ namespace GEX
 				currentFrame_ = (currentFrame_ + 1) % numberOfFrames_;
 
 				if (currentFrame_ == 0)
-					textureRect = sf::IntRect(0, 0, frameSize_.x, frameSize_.y);
+					textureRect = firstFrame;
 			}
 			else
 			{
@@ -174,6 +200,11 @@ namespace GEX
 		sprite_.setTextureRect(textureRect);	
 	}
 
+	const sf::Sprite& Animation::getSprite() const
+	{
+		return sprite_;
+	}
+
 	void Animation::draw(sf::RenderTarget& target, sf::RenderStates states) const
 	{
 		states.transform *= getTransform();
@@ -48,8 +48,11 @@ namespace GEX
 	public:
 							Animation();
 							Animation(const sf::Texture& texture);
+							Animation(const sf::Texture& texture, const sf::IntRect& sheet);
+		explicit			Animation(const sf::Sprite& sheet);
 
 		void				setTexture(const sf::Texture& texture);
+		void				setTexture(const sf::Texture& texture, const sf::IntRect& sheet);
 		const sf::Texture*	getTexture() const;
 
 		void				setFrameSize(sf::Vector2i frameSize);
@@ -70,6 +73,8 @@ namespace GEX
 		sf::FloatRect		getLocalBounds() const;
 		sf::FloatRect		getGlobalBounds() const;
 
+		const sf::Sprite&	getSprite() const;
+
 		void				update(sf::Time dt);
 
 	private:
@@ -77,6 +82,7 @@ namespace GEX
 
 	private:
 		sf::Sprite			sprite_;
+		sf::IntRect			sheet_;			// frames are laid out inside this part of the texture
 		sf::Vector2i		frameSize_;
 		std::size_t			numberOfFrames_;
 		std::size_t			currentFrame_;
@@ -0,0 +1,133 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* AnimationClip Class
+* Frames of an animation cut once and shared, evaluated in closed form from the time into the clip
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "AnimationClip.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace GEX
+{
+	AnimationClip::AnimationClip(const sf::Texture* texture, const sf::IntRect& sheet, sf::Vector2i frameSize,
+								 std::size_t numFrames, sf::Time duration, bool repeat)
+		: texture_(texture)
+		, frames_()
+		, duration_(duration)
+		, timePerFrame_(sf::Time::Zero)
+		, repeat_(repeat)
+		, origin_()
+	{
+		assert(numFrames > 0);
+
+		if (frameSize == sf::Vector2i())
+			frameSize = sf::Vector2i(sheet.width, sheet.height);
+
+		frames_.reserve(numFrames);
+
+		sf::IntRect frame(sheet.left, sheet.top, frameSize.x, frameSize.y);
+		for (std::size_t i = 0; i < numFrames; ++i)
+		{
+			frames_.push_back(frame);
+
+			// Next frame, wrapping to the next row at the end of the sheet
+			frame.left += frame.width;
+			if (frame.left + frame.width > sheet.left + sheet.width)
+			{
+				frame.left = sheet.left;
+				frame.top += frame.height;
+			}
+		}
+
+		timePerFrame_ = duration_ / static_cast<float>(numFrames);
+		origin_ = sf::Vector2f(frameSize.x / 2.f, frameSize.y / 2.f);
+	}
+
+	const sf::Texture* AnimationClip::getTexture() const
+	{
+		return texture_;
+	}
+
+	const sf::IntRect& AnimationClip::getFrame(std::size_t index) const
+	{
+		assert(index < frames_.size());
+		return frames_[index];
+	}
+
+	std::size_t AnimationClip::getNumFrames() const
+	{
+		return frames_.size();
+	}
+
+	sf::Time AnimationClip::getDuration() const
+	{
+		return duration_;
+	}
+
+	sf::Time AnimationClip::getTimePerFrame() const
+	{
+		return timePerFrame_;
+	}
+
+	bool AnimationClip::isRepeating() const
+	{
+		return repeat_;
+	}
+
+	sf::Vector2f AnimationClip::getOrigin() const
+	{
+		return origin_;
+	}
+
+	std::size_t AnimationClip::getFrameIndex(sf::Time elapsed) const
+	{
+		const sf::Int64 step = timePerFrame_.asMicroseconds();
+		if (step <= 0 || elapsed <= sf::Time::Zero)
+			return 0;
+
+		const std::size_t frame = static_cast<std::size_t>(elapsed.asMicroseconds() / step);
+
+		return repeat_ ? frame % frames_.size() : std::min(frame, frames_.size() - 1);
+	}
+
+	const sf::IntRect& AnimationClip::getFrameAt(sf::Time elapsed) const
+	{
+		return frames_[getFrameIndex(elapsed)];
+	}
+
+	bool AnimationClip::isFinished(sf::Time elapsed) const
+	{
+		return !repeat_ && elapsed >= duration_;
+	}
+}
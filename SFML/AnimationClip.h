@@ -0,0 +1,79 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* AnimationClip Class
+* Frames of an animation cut once and shared, evaluated in closed form from the time into the clip
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+namespace GEX
+{
+	// Immutable once built; every entity playing the clip points at the same instance and only
+	// knows how long it has been playing it, the frame is worked out from that when it is drawn
+	class AnimationClip
+	{
+	public:
+			//frames are read left to right then top to bottom out of sheet, a zero frame size takes the whole sheet
+									AnimationClip(const sf::Texture* texture, const sf::IntRect& sheet, sf::Vector2i frameSize,
+												  std::size_t numFrames, sf::Time duration, bool repeat);
+
+		const sf::Texture*			getTexture() const;
+		const sf::IntRect&			getFrame(std::size_t index) const;
+		std::size_t					getNumFrames() const;
+
+		sf::Time					getDuration() const;
+		sf::Time					getTimePerFrame() const;
+		bool						isRepeating() const;
+
+		sf::Vector2f				getOrigin() const;		// center of a frame
+
+			//frame shown elapsed into the clip, a clip that does not repeat holds its last frame
+		std::size_t					getFrameIndex(sf::Time elapsed) const;
+		const sf::IntRect&			getFrameAt(sf::Time elapsed) const;
+		bool						isFinished(sf::Time elapsed) const;
+
+	private:
+		const sf::Texture*			texture_;		// null in headless mode
+		std::vector<sf::IntRect>	frames_;
+		sf::Time					duration_;
+		sf::Time					timePerFrame_;
+		bool						repeat_;
+		sf::Vector2f				origin_;
+	};
+}
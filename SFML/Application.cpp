@@ -41,12 +41,19 @@
 #include "GameOverState.h"
 #include "HighscoreState.h"
 #include "FontManager.h"
+#include "Profiler.h"
 
-const sf::Time Application::TimePerFrame = sf::seconds(1.0f / 60.0f);		//seconds per frame for 60 fps
+#include <cassert>
+
+const unsigned int Application::DefaultTickRate = 60;		//simulation steps per second
+const unsigned int Application::MaxUpdatesPerFrame = 5;		//catch up limit before the simulation slows down instead
+const sf::Keyboard::Key Application::ProfileDumpKey = sf::Keyboard::F9;	//writes the profiler's recent history, profiling builds only
+const sf::Keyboard::Key Application::FrameTimesDumpKey = sf::Keyboard::F10;	//writes the frame time window as CSV
 
 
 Application::Application()
-	: window_(sf::VideoMode(1680, 1050), "Boxhead", sf::Style::Close)
+	: timePerTick_(sf::seconds(1.f / DefaultTickRate))
+	, window_(sf::VideoMode(1680, 1050), "Boxhead", sf::Style::Close)
 	, player_()
 	, textures_()
 	, music_()
@@ -55,6 +62,9 @@ Application::Application()
 	, statisticsText_()
 	, statisticsUpdateTime_()
 	, statisticsNumFrames_(0)
+	, frameStatistics_(timePerTick_)
+	, frameTimesDumps_(0)
+	, profileDumps_(0)
 {
 	window_.setKeyRepeatEnabled(false);
 
@@ -65,9 +75,12 @@ Application::Application()
 	textures_.load(GEX::TextureID::GEXStateFace, "Media/face.png");
 
 	statisticsText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
-	statisticsText_.setPosition(1500.f, 15.0f);
+	statisticsText_.setPosition(1360.f, 15.0f);
 	statisticsText_.setCharacterSize(15);
-	statisticsText_.setString("Frames Per Second = \nTime / Update = ");
+	statisticsText_.setString("Frames Per Second = \nFrame p50 / p95 / p99 = \nMax = ");
+
+	frameStatistics_.setPosition(1360.f, 80.f);
+	frameStatistics_.setGraphSize(sf::Vector2f(300.f, 90.f));
 
 	registerStates();
 	stateStack_.pushState(GEX::StateID::Menu);
@@ -77,26 +90,58 @@ void Application::run()
 {
 	sf::Clock clock;
 	sf::Time timeSinceLastUpdate = sf::Time::Zero;
+	sf::Time previousUpdateTime = sf::Time::Zero;
 
 	while (window_.isOpen())
 	{
-		timeSinceLastUpdate += clock.restart();
+		sf::Time frameTime = clock.restart();
+		timeSinceLastUpdate += frameTime;
+
+		unsigned int updates = 0;
+		sf::Clock updateClock;
 
-		while (timeSinceLastUpdate > TimePerFrame)
+		while (timeSinceLastUpdate >= timePerTick_ && updates < MaxUpdatesPerFrame)
 		{
-			timeSinceLastUpdate -= TimePerFrame;
+			timeSinceLastUpdate -= timePerTick_;
+			++updates;
 
 			processInput();
-			update(TimePerFrame);
+			update(timePerTick_);
 
 			if (stateStack_.isEmpty())
 				window_.close();
 		}
 
-		updateStatistics(timeSinceLastUpdate);
+		//Too far behind to catch up, drop the backlog and let the game run slower than real time
+		if (timeSinceLastUpdate >= timePerTick_)
+			timeSinceLastUpdate = sf::microseconds(timeSinceLastUpdate.asMicroseconds() % timePerTick_.asMicroseconds());
 
-		render();
+		//frameTime spans the previous frame, so pair it with that frame's update time
+		updateStatistics(frameTime, previousUpdateTime);
+		previousUpdateTime = updateClock.getElapsedTime();
+
+		//How far we are between the last simulated state and the next one
+		render(timeSinceLastUpdate / timePerTick_);
 	}
+
+	dumpProfile("trace_exit.json");
+}
+
+void Application::setTickRate(unsigned int ticksPerSecond)
+{
+	assert(ticksPerSecond > 0);
+	timePerTick_ = sf::seconds(1.f / ticksPerSecond);
+	frameStatistics_.setBudget(timePerTick_);
+}
+
+void Application::recordReplay(const std::string& path)
+{
+	player_.setRecordPath(path);
+}
+
+void Application::playReplay(const std::string& path)
+{
+	player_.setReplayPath(path);
 }
 
 void Application::processInput()
@@ -109,39 +154,74 @@ void Application::processInput()
 
 		if (event.type == sf::Event::Closed)
 			window_.close();
+
+		if (event.type == sf::Event::KeyPressed && event.key.code == ProfileDumpKey)
+			dumpProfile("trace_" + std::to_string(++profileDumps_) + ".json");
+
+		if (event.type == sf::Event::KeyPressed && event.key.code == FrameTimesDumpKey)
+			frameStatistics_.writeCsv("frame_times_" + std::to_string(++frameTimesDumps_) + ".csv");
 	}
 }
 
 void Application::update(sf::Time dt)
 {
+	GEX_PROFILE_SCOPE("Application::update");
+
 	stateStack_.update(dt);
 }
 
-void Application::render()
+void Application::render(float interpolation)
 {
+	GEX_PROFILE_SCOPE("Application::render");
+
 	window_.clear();
+	stateStack_.setInterpolation(interpolation);
 	stateStack_.draw();
 
 	window_.setView(window_.getDefaultView());
 	window_.draw(statisticsText_);
+	window_.draw(frameStatistics_);
 	window_.display();
 }
 
-void Application::updateStatistics(sf::Time dt)
+//Tail latency over the last few seconds, averages hide the hitches
+void Application::updateStatistics(sf::Time frameTime, sf::Time updateTime)
 {
-	statisticsUpdateTime_ += dt;
+	frameStatistics_.record(frameTime, updateTime);
+
+	statisticsUpdateTime_ += frameTime;
 	statisticsNumFrames_ += 1;
 
 	if (statisticsUpdateTime_ > sf::seconds(1))
 	{
+		auto toMilliseconds = [](sf::Time time)
+		{
+			std::string text = std::to_string(time.asMicroseconds() / 100 / 10.f);
+			return text.substr(0, text.find('.') + 2);
+		};
+
 		statisticsText_.setString("Frames Per Second = " + std::to_string(statisticsNumFrames_) + "\n" +
-			"Time / Update = " + std::to_string(statisticsUpdateTime_.asMicroseconds() / statisticsNumFrames_));
+			"Frame p50 / p95 / p99 = " + toMilliseconds(frameStatistics_.getPercentile(0.50f)) + " / " +
+			toMilliseconds(frameStatistics_.getPercentile(0.95f)) + " / " +
+			toMilliseconds(frameStatistics_.getPercentile(0.99f)) + " ms\n" +
+			"Max = " + toMilliseconds(frameStatistics_.getMax()) + " ms, over budget " +
+			std::to_string(frameStatistics_.getOverBudgetCount()) + " / " + std::to_string(frameStatistics_.getSampleCount()));
 
 		statisticsUpdateTime_ -= sf::seconds(1);
 		statisticsNumFrames_ = 0;
 	}
 }
 
+//Chrome trace of the last few seconds, open it in chrome://tracing or ui.perfetto.dev
+void Application::dumpProfile(const std::string& path) const
+{
+#if GEX_PROFILING
+	GEX::Profiler::getInstance().writeChromeTrace(path);
+#else
+	(void)path;
+#endif
+}
+
 void Application::registerStates()
 {
 	stateStack_.registerState<TitleState>(GEX::StateID::Title);
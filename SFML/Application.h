@@ -38,11 +38,15 @@
 #include "StateStack.h"
 #include "MusicPlayer.h"
 #include "SoundPlayer.h"
+#include "FrameStatistics.h"
 
-#include <SFML\System\Time.hpp>
-#include <SFML\Graphics\RenderWindow.hpp>
-#include <SFML\Graphics\Font.hpp>
-#include <SFML\Graphics\Text.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+#include <string>
 
 
 class Application
@@ -52,17 +56,30 @@ class Application
 
 		void						run();
 
+		void						setTickRate(unsigned int ticksPerSecond);
+
+			//games record their input to, or replay it from, this file
+		void						recordReplay(const std::string& path);
+		void						playReplay(const std::string& path);
+
 	private:
 		void						processInput();
 		void						update(sf::Time dt);
-		void						render();
+		void						render(float interpolation);
 
-		void						updateStatistics(sf::Time dt);
+		void						updateStatistics(sf::Time frameTime, sf::Time updateTime);
 		void						registerStates();
 
+		void						dumpProfile(const std::string& path) const;
+
 	private:
-		static const sf::Time		TimePerFrame;
-		
+		static const unsigned int	DefaultTickRate;
+		static const unsigned int	MaxUpdatesPerFrame;
+		static const sf::Keyboard::Key	ProfileDumpKey;
+		static const sf::Keyboard::Key	FrameTimesDumpKey;
+
+		sf::Time					timePerTick_;
+
 		sf::RenderWindow			window_;
 		GEX::PlayerControl			player_;
 		GEX::TextureManager			textures_;
@@ -75,4 +92,8 @@ class Application
 		sf::Text					statisticsText_;
 		sf::Time					statisticsUpdateTime_;
 		unsigned int				statisticsNumFrames_;
+		GEX::FrameStatistics		frameStatistics_;
+		unsigned int				frameTimesDumps_;
+
+		unsigned int				profileDumps_;
 };
@@ -0,0 +1,123 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CategoryRegistry Class
+* Index of the scene graph's nodes by category, used to route commands
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "CategoryRegistry.h"
+#include "SceneNode.h"
+#include "Command.h"
+
+#include <algorithm>
+
+namespace GEX
+{
+	CategoryRegistry::CategoryRegistry()
+		: nodes_()
+	{
+	}
+
+	void CategoryRegistry::add(SceneNode& node)
+	{
+		unsigned int category = node.getCategory();
+
+		for (std::size_t bit = 0; bit < CategoryCount; ++bit)
+		{
+			if (category & (1u << bit))
+				nodes_[bit].push_back(&node);
+		}
+	}
+
+	void CategoryRegistry::remove(std::vector<SceneNode*>& nodes)
+	{
+		unsigned int categories = 0;
+		for (SceneNode* node : nodes)
+			categories |= node->getCategory();
+
+		if (categories == 0)
+			return;
+
+		// Sort once so each category list is compacted in a single pass
+		std::sort(nodes.begin(), nodes.end());
+
+		for (std::size_t bit = 0; bit < CategoryCount; ++bit)
+		{
+			if (!(categories & (1u << bit)))
+				continue;
+
+			auto& list = nodes_[bit];
+			list.erase(std::remove_if(list.begin(), list.end(), [&nodes](SceneNode* node)
+			{
+				return std::binary_search(nodes.begin(), nodes.end(), node);
+			}), list.end());
+		}
+	}
+
+	void CategoryRegistry::onCommand(const Command& command, sf::Time dt)
+	{
+		for (std::size_t bit = 0; bit < CategoryCount; ++bit)
+		{
+			const unsigned int mask = 1u << bit;
+
+			if (!(command.category & mask))
+				continue;
+
+			// Nodes matching a lower bit of the command were already visited
+			const unsigned int visitedCategories = command.category & (mask - 1);
+			auto& list = nodes_[bit];
+
+			// Actions may attach new nodes, they only receive the next command
+			for (std::size_t i = 0, count = list.size(); i < count; ++i)
+			{
+				SceneNode* node = list[i];
+
+				if (visitedCategories != 0 && (node->getCategory() & visitedCategories))
+					continue;
+
+				command.action(*node, dt);
+			}
+		}
+	}
+
+	std::size_t CategoryRegistry::getNodeCount(unsigned int category) const
+	{
+		std::size_t count = 0;
+
+		for (std::size_t bit = 0; bit < CategoryCount; ++bit)
+		{
+			if (category & (1u << bit))
+				count += nodes_[bit].size();
+		}
+
+		return count;
+	}
+}
@@ -0,0 +1,67 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CategoryRegistry Class
+* Index of the scene graph's nodes by category, used to route commands
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <vector>
+
+namespace GEX
+{
+	// forward declarations
+	class SceneNode;
+	struct Command;
+
+	class CategoryRegistry
+	{
+	public:
+									CategoryRegistry();
+
+		void						add(SceneNode& node);
+		void						remove(std::vector<SceneNode*>& nodes);
+
+		void						onCommand(const Command& command, sf::Time dt);
+
+		std::size_t					getNodeCount(unsigned int category) const;
+
+	private:
+		static const std::size_t	CategoryCount = 32;
+
+	private:
+		std::array<std::vector<SceneNode*>, CategoryCount>	nodes_;
+	};
+}
@@ -38,6 +38,68 @@
 
 namespace GEX
 { 
+	const std::size_t CommandAction::Capacity;
+
+	CommandAction::CommandAction()
+		: invoke_(nullptr)
+		, manage_(nullptr)
+	{
+	}
+
+	CommandAction::~CommandAction()
+	{
+		reset();
+	}
+
+	CommandAction::CommandAction(CommandAction&& other) noexcept
+		: invoke_(other.invoke_)
+		, manage_(other.manage_)
+	{
+		if (manage_)
+			manage_(&storage_, &other.storage_);
+
+		other.invoke_ = nullptr;
+		other.manage_ = nullptr;
+	}
+
+	CommandAction& CommandAction::operator=(CommandAction&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+
+			invoke_ = other.invoke_;
+			manage_ = other.manage_;
+			if (manage_)
+				manage_(&storage_, &other.storage_);
+
+			other.invoke_ = nullptr;
+			other.manage_ = nullptr;
+		}
+
+		return *this;
+	}
+
+	void CommandAction::operator()(SceneNode& node, sf::Time dt) const
+	{
+		assert(invoke_);
+		invoke_(&storage_, node, dt);
+	}
+
+	CommandAction::operator bool() const
+	{
+		return invoke_ != nullptr;
+	}
+
+	void CommandAction::reset()
+	{
+		if (manage_)
+			manage_(nullptr, &storage_);
+
+		invoke_ = nullptr;
+		manage_ = nullptr;
+	}
+
 	Command::Command()
 		: action()
 		, category(Category::Type::None)
@@ -34,11 +34,14 @@
 
 #pragma once
 
-#include <SFML\System\Time.hpp>
+#include <SFML/System/Time.hpp>
 
 #include "Category.h"
-#include <functional>
 #include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace GEX
 { 
@@ -46,17 +49,101 @@ namespace GEX
 	//forward declaration
 	class SceneNode;
 
+	// A void(SceneNode&, sf::Time) callable kept inline, never on the heap. Captures larger
+	// than Capacity fail to compile, capture a pointer instead. Move only, a command is
+	// built where it is pushed and consumed once
+	class CommandAction
+	{
+	public:
+		static const std::size_t	Capacity = 48;
+
+	public:
+									CommandAction();
+									~CommandAction();
+
+									CommandAction(CommandAction&& other) noexcept;
+		CommandAction&				operator=(CommandAction&& other) noexcept;
+
+									CommandAction(const CommandAction&) = delete;
+		CommandAction&				operator=(const CommandAction&) = delete;
+
+		template <typename Function, typename = typename std::enable_if<
+			!std::is_same<typename std::decay<Function>::type, CommandAction>::value>::type>
+									CommandAction(Function&& fn);
+
+		template <typename Function, typename = typename std::enable_if<
+			!std::is_same<typename std::decay<Function>::type, CommandAction>::value>::type>
+		CommandAction&				operator=(Function&& fn);
+
+		void						operator()(SceneNode& node, sf::Time dt) const;
+		explicit					operator bool() const;
+
+	private:
+		using Invoker =				void(*)(void* storage, SceneNode& node, sf::Time dt);
+			//moves the callable from source into destination then destroys source, destination null only destroys
+		using Manager =				void(*)(void* destination, void* source);
+
+		template <typename Function>
+		void						store(Function&& fn);
+		void						reset();
+
+	private:
+		mutable typename std::aligned_storage<Capacity>::type	storage_;
+		Invoker						invoke_;
+		Manager						manage_;
+	};
+
 	struct Command
 	{
 	public:
 		Command();
 		
-		std::function<void(SceneNode&, sf::Time)>	action;
+		CommandAction								action;
 		unsigned int								category;
 	};
 
+	template <typename Function, typename>
+	CommandAction::CommandAction(Function&& fn)
+		: invoke_(nullptr)
+		, manage_(nullptr)
+	{
+		store(std::forward<Function>(fn));
+	}
+
+	template <typename Function, typename>
+	CommandAction& CommandAction::operator=(Function&& fn)
+	{
+		reset();
+		store(std::forward<Function>(fn));
+		return *this;
+	}
+
+	template <typename Function>
+	void CommandAction::store(Function&& fn)
+	{
+		using Callable = typename std::decay<Function>::type;
+
+		static_assert(sizeof(Callable) <= Capacity, "Command action captures too much, capture a pointer instead");
+		static_assert(alignof(Callable) <= alignof(decltype(storage_)), "Command action is over aligned");
+
+		new (&storage_) Callable(std::forward<Function>(fn));
+
+		invoke_ = [](void* storage, SceneNode& node, sf::Time dt)
+		{
+			(*static_cast<Callable*>(storage))(node, dt);
+		};
+
+		manage_ = [](void* destination, void* source)
+		{
+			Callable* callable = static_cast<Callable*>(source);
+			if (destination)
+				new (destination) Callable(std::move(*callable));
+			callable->~Callable();
+		};
+	}
+
 	template <typename GameObject, typename Function>
-	std::function<void(SceneNode&, sf::Time)> derivedAction(Function fn)
+	auto derivedAction(Function fn)
 	{
 		return [=](SceneNode& node, sf::Time dt)
 		{
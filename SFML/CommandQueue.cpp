@@ -34,32 +34,66 @@
 
 #include "CommandQueue.h"
 
+#include <cassert>
+#include <utility>
+
 namespace GEX
 {
-	void CommandQueue::push(const Command & command)
+	namespace
 	{
-		queue_.push(command);
+		const std::size_t INITIAL_CAPACITY = 256;	// power of two, indices wrap with a mask
 	}
 
-	Command CommandQueue::pop()
+	CommandQueue::CommandQueue()
+	: buffer_(INITIAL_CAPACITY)
+	, head_(0)
+	, size_(0)
 	{
-		/*auto cmd = queue_.front();
-		queue_.pop();
-		return cmd;*/
+	}
+
+	void CommandQueue::push(Command&& command)
+	{
+		if (size_ == buffer_.size())
+			grow();
+
+		buffer_[(head_ + size_) & (buffer_.size() - 1)] = std::move(command);
+		++size_;
+	}
+
+	Command& CommandQueue::front()
+	{
+		assert(size_ > 0);
+		return buffer_[head_];
+	}
 
-		Command comm;
+	void CommandQueue::pop()
+	{
+		assert(size_ > 0);
 
-		if (!queue_.empty())
-		{
-			comm = queue_.front();
-			queue_.pop();
-		}
-		
-		return comm;
+		//Release the callable now rather than when the slot is next overwritten
+		buffer_[head_] = Command();
+		head_ = (head_ + 1) & (buffer_.size() - 1);
+		--size_;
 	}
 
 	bool CommandQueue::isEmpty() const
 	{
-		return queue_.empty();
+		return size_ == 0;
+	}
+
+	std::size_t CommandQueue::getSize() const
+	{
+		return size_;
+	}
+
+	void CommandQueue::grow()
+	{
+		std::vector<Command> larger(buffer_.size() * 2);
+
+		for (std::size_t i = 0; i < size_; ++i)
+			larger[i] = std::move(buffer_[(head_ + i) & (buffer_.size() - 1)]);
+
+		buffer_.swap(larger);
+		head_ = 0;
 	}
 }
\ No newline at end of file
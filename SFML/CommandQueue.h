@@ -35,19 +35,32 @@
 #pragma once
 
 #include "Command.h"
-#include <queue>
+#include <vector>
 
 namespace GEX
 { 
+	// Ring buffer of commands. Slots are reused tick after tick, so once the buffer has
+	// grown to the busiest tick pushing and popping never allocates
 	class CommandQueue
 	{
 	public:
-		void				push(const Command& command);
-		Command				pop();
+							CommandQueue();
+
+		void				push(Command&& command);
+
+			//the oldest command, invalidated by push; move it out first if running it may push more
+		Command&			front();
+		void				pop();
 
 		bool				isEmpty() const;
+		std::size_t			getSize() const;
+
+	private:
+		void				grow();
 
 	private:
-		std::queue<Command>	queue_;
+		std::vector<Command>	buffer_;
+		std::size_t			head_;
+		std::size_t			size_;
 	};
 }
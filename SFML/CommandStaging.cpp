@@ -0,0 +1,73 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CommandStaging Class
+* Per producer command lanes for worker threads, merged in lane order before dispatch
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "CommandStaging.h"
+
+#include <cassert>
+#include <utility>
+
+namespace GEX
+{
+	const std::size_t CommandStaging::CacheLineSize;
+
+	CommandStaging::CommandStaging(std::size_t laneCount)
+	: lanes_(laneCount)
+	{
+		assert(laneCount > 0);
+	}
+
+	std::size_t CommandStaging::getLaneCount() const
+	{
+		return lanes_.size();
+	}
+
+	CommandQueue& CommandStaging::getLane(std::size_t index)
+	{
+		assert(index < lanes_.size());
+		return lanes_[index].queue;
+	}
+
+	void CommandStaging::mergeInto(CommandQueue& target)
+	{
+		for (Lane& lane : lanes_)
+		{
+			while (!lane.queue.isEmpty())
+			{
+				target.push(std::move(lane.queue.front()));
+				lane.queue.pop();
+			}
+		}
+	}
+}
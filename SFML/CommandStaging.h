@@ -0,0 +1,76 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CommandStaging Class
+* Per producer command lanes for worker threads, merged in lane order before dispatch
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include "CommandQueue.h"
+
+#include <vector>
+
+namespace GEX
+{ 
+	// Worker threads push commands into their own lane, so producers never share memory
+	// and need no lock or atomic. Lanes are indexed by job, not by thread: whichever thread
+	// runs job i writes lane i, and merging walks lanes in index order, so the dispatched
+	// order is the same on every run however the threads were scheduled
+	class CommandStaging
+	{
+	public:
+		explicit			CommandStaging(std::size_t laneCount);
+
+		std::size_t			getLaneCount() const;
+
+			//one writer per lane at a time, and never while a merge is running
+		CommandQueue&		getLane(std::size_t index);
+
+			//call after the producers have joined, appends lane 0 first, then lane 1...
+		void				mergeInto(CommandQueue& target);
+
+	private:
+		static const std::size_t	CacheLineSize = 64;
+
+		// A full cache line after each queue keeps neighbouring lanes' head and size counters
+		// off each other's lines whatever the vector's alignment; alignas(64) is not honoured
+		// by std::allocator before C++17
+		struct Lane
+		{
+			CommandQueue	queue;
+			char			padding[CacheLineSize];
+		};
+
+	private:
+		std::vector<Lane>	lanes_;
+	};
+}
@@ -34,9 +34,9 @@
 
 #pragma once
 
-#include <SFML\System\NonCopyable.hpp>
-#include <SFML\Graphics\Drawable.hpp>
-#include <SFML\Graphics\Transformable.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
 
 #include <memory>
 
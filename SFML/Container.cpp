@@ -34,8 +34,8 @@
 
 #include "Container.h"
 
-#include <SFML\Window\Event.hpp>
-#include <SFML\Graphics\RenderTarget.hpp>
+#include <SFML/Window/Event.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 
 namespace GUI
 { 
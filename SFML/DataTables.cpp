@@ -36,7 +36,7 @@
 
 namespace GEX
 { 
-	std::map<Zombie::ZombieType, ZombieData> GEX::initializeZombieData()
+	std::map<Zombie::ZombieType, ZombieData> initializeZombieData()
 	{
 		std::map<Zombie::ZombieType, ZombieData> data;
 
@@ -45,11 +45,55 @@ namespace GEX
 		data[Zombie::ZombieType::Zombie].texture = TextureID::Zombie;
 		data[Zombie::ZombieType::Zombie].attackInterval = sf::seconds(1);
 		data[Zombie::ZombieType::Zombie].damage = 1;
+
+		data[Zombie::ZombieType::Zombie].animations[Zombie::State::Up] = AnimationID::ZombieWalkUp;
+		data[Zombie::ZombieType::Zombie].animations[Zombie::State::Left] = AnimationID::ZombieWalkLeft;
+		data[Zombie::ZombieType::Zombie].animations[Zombie::State::Down] = AnimationID::ZombieWalkDown;
+		data[Zombie::ZombieType::Zombie].animations[Zombie::State::Right] = AnimationID::ZombieWalkRight;
+		data[Zombie::ZombieType::Zombie].animations[Zombie::State::Dead] = AnimationID::ZombieDeath;
 		
 		return data;
 	}
 
-	std::map<Skeleton::SkeletonType, SkeletonData> GEX::initializeSkeletonData()
+	std::vector<WaveData> initializeWaveData()
+	{
+		std::vector<WaveData> data;
+
+		//			type							budget	cap		duration			ramp	rest
+		data.push_back({ Zombie::ZombieType::Zombie,	10,		10,		sf::seconds(20.f),	1.f,	sf::seconds(6.f) });
+		data.push_back({ Zombie::ZombieType::Zombie,	20,		15,		sf::seconds(25.f),	1.2f,	sf::seconds(6.f) });
+		data.push_back({ Zombie::ZombieType::Zombie,	40,		25,		sf::seconds(30.f),	1.5f,	sf::seconds(8.f) });
+		data.push_back({ Zombie::ZombieType::Zombie,	80,		40,		sf::seconds(30.f),	2.f,	sf::seconds(8.f) });
+		data.push_back({ Zombie::ZombieType::Zombie,	200,	80,		sf::seconds(20.f),	3.f,	sf::seconds(10.f) });
+
+		return data;
+	}
+
+	std::map<AnimationID, AnimationData> initializeAnimationData()
+	{
+		std::map<AnimationID, AnimationData> data;
+
+		//											texture							frame size				frames	duration				repeat
+		data[AnimationID::ZombieWalkUp] =		{ TextureID::ZombieWalkUp,		sf::Vector2i(33, 45),	3,		sf::seconds(0.5f),		true };
+		data[AnimationID::ZombieWalkLeft] =		{ TextureID::ZombieWalkLeft,	sf::Vector2i(33, 45),	3,		sf::seconds(0.5f),		true };
+		data[AnimationID::ZombieWalkDown] =		{ TextureID::ZombieWalkDown,	sf::Vector2i(33, 45),	3,		sf::seconds(0.5f),		true };
+		data[AnimationID::ZombieWalkRight] =	{ TextureID::ZombieWalkRight,	sf::Vector2i(33, 45),	3,		sf::seconds(0.5f),		true };
+		data[AnimationID::ZombieDeath] =		{ TextureID::ZombieDeath,		sf::Vector2i(40, 45),	3,		sf::seconds(1.5f),		false };
+
+		data[AnimationID::PlayerWalkUp] =		{ TextureID::PlayerWalkUp,		sf::Vector2i(27, 39),	7,		sf::seconds(1.5f),		true };
+		data[AnimationID::PlayerWalkLeft] =		{ TextureID::PlayerWalkLeft,	sf::Vector2i(30, 39),	7,		sf::seconds(1.5f),		true };
+		data[AnimationID::PlayerWalkDown] =		{ TextureID::PlayerWalkDown,	sf::Vector2i(26, 39),	7,		sf::seconds(1.5f),		true };
+		data[AnimationID::PlayerWalkRight] =	{ TextureID::PlayerWalkRight,	sf::Vector2i(30, 39),	7,		sf::seconds(1.5f),		true };
+		data[AnimationID::PlayerIdleUp] =		{ TextureID::PlayerIdleUp,		sf::Vector2i(),			1,		sf::Time::Zero,			true };
+		data[AnimationID::PlayerIdleLeft] =		{ TextureID::PlayerIdleLeft,	sf::Vector2i(),			1,		sf::Time::Zero,			true };
+		data[AnimationID::PlayerIdleDown] =		{ TextureID::PlayerIdleDown,	sf::Vector2i(),			1,		sf::Time::Zero,			true };
+		data[AnimationID::PlayerIdleRight] =	{ TextureID::PlayerIdleRight,	sf::Vector2i(),			1,		sf::Time::Zero,			true };
+		data[AnimationID::PlayerDeath] =		{ TextureID::PlayerDeath,		sf::Vector2i(35, 39),	4,		sf::seconds(1.f),		false };
+
+		return data;
+	}
+
+	std::map<Skeleton::SkeletonType, SkeletonData> initializeSkeletonData()
 	{
 		std::map<Skeleton::SkeletonType, SkeletonData> data;
 
@@ -61,7 +105,7 @@ namespace GEX
 		return data;
 	}
 
-	std::map<Player::Type, PlayerData> GEX::initializePlayerData()
+	std::map<Player::Type, PlayerData> initializePlayerData()
 	{
 		std::map <Player::Type, PlayerData> data;
 
@@ -76,10 +120,20 @@ namespace GEX
 		data[Player::Type::Player].textureIdleDown = TextureID::PlayerIdleDown;
 		data[Player::Type::Player].textureIdleRight = TextureID::PlayerIdleRight;
 
+		data[Player::Type::Player].animations[Player::State::WalkUp] = AnimationID::PlayerWalkUp;
+		data[Player::Type::Player].animations[Player::State::WalkLeft] = AnimationID::PlayerWalkLeft;
+		data[Player::Type::Player].animations[Player::State::WalkDown] = AnimationID::PlayerWalkDown;
+		data[Player::Type::Player].animations[Player::State::WalkRight] = AnimationID::PlayerWalkRight;
+		data[Player::Type::Player].animations[Player::State::IdleUp] = AnimationID::PlayerIdleUp;
+		data[Player::Type::Player].animations[Player::State::IdleLeft] = AnimationID::PlayerIdleLeft;
+		data[Player::Type::Player].animations[Player::State::IdleDown] = AnimationID::PlayerIdleDown;
+		data[Player::Type::Player].animations[Player::State::IdleRight] = AnimationID::PlayerIdleRight;
+		data[Player::Type::Player].animations[Player::State::Dead] = AnimationID::PlayerDeath;
+
 		return data;
 	}
 
-	std::map<Pickup::Type, PickupData> GEX::initializePickupData()
+	std::map<Pickup::Type, PickupData> initializePickupData()
 	{
 		std::map <Pickup::Type, PickupData> data;
 
@@ -90,7 +144,7 @@ namespace GEX
 		return data;
 	}
 
-	std::map<Projectile::Type, ProjectileData> GEX::initializeProjectileData()
+	std::map<Projectile::Type, ProjectileData> initializeProjectileData()
 	{
 		std::map <Projectile::Type, ProjectileData> data;
 
@@ -102,7 +156,7 @@ namespace GEX
 		return data;
 	}
 
-	std::map<Particle::Type, ParticleData> GEX::initializeParticleData()
+	std::map<Particle::Type, ParticleData> initializeParticleData()
 	{
 		std::map <Particle::Type, ParticleData> data;
 
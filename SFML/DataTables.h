@@ -42,8 +42,8 @@
 #include "Skeleton.h"
 #include "Zombie.h"
 
-#include <SFML\System\Time.hpp>
-#include <SFML\Graphics\Color.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Graphics/Color.hpp>
 
 #include <vector>
 #include <map>
@@ -76,6 +76,8 @@ namespace GEX
 		TextureID						textureIdleLeft;
 		TextureID						textureIdleRight;
 
+		std::map<Player::State, AnimationID>	animations;
+
 		std::vector<Direction>			directions;
 	};
 
@@ -86,6 +88,29 @@ namespace GEX
 		TextureID						texture;
 		sf::Time						attackInterval;
 		int								damage;
+
+		std::map<Zombie::State, AnimationID>	animations;
+	};
+
+	// A wave releases its budget over duration along (elapsed / duration)^ramp, so ramp 1 is steady
+	// and a higher ramp holds most of the wave back for a late rush
+	struct WaveData
+	{
+		Zombie::ZombieType				type;
+		std::size_t						budget;
+		std::size_t						aliveCap;
+		sf::Time						duration;
+		float							ramp;
+		sf::Time						rest;		// pause after the last zombie of the wave dies
+	};
+
+	struct AnimationData
+	{
+		TextureID						texture;
+		sf::Vector2i					frameSize;		// zero for a single frame covering the whole image
+		std::size_t						numFrames;
+		sf::Time						duration;
+		bool							repeat;
 	};
 
 	struct SkeletonData
@@ -123,4 +148,6 @@ namespace GEX
 	std::map<Particle::Type, ParticleData>		    initializeParticleData();
 	std::map<Zombie::ZombieType, ZombieData>	    initializeZombieData();
 	std::map<Skeleton::SkeletonType, SkeletonData>	initializeSkeletonData();
+	std::vector<WaveData>							initializeWaveData();
+	std::map<AnimationID, AnimationData>			initializeAnimationData();
 }
\ No newline at end of file
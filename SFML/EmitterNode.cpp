@@ -43,13 +43,15 @@ namespace GEX
 		: SceneNode()
 		, accumulatedTime_(sf::Time::Zero)
 		, type_(type)
-		, particleSystem_(nullptr)
+		, particleSystem_()
 	{
 	}
 
 	void EmitterNode::updateCurrent(sf::Time dt, CommandQueue & commands)
 	{
-		if (particleSystem_)
+		EntityRegistry* entities = getEntityRegistry();
+
+		if (entities && entities->isValid(particleSystem_))
 		{
 			emitParticle(dt);
 		}
@@ -58,14 +60,14 @@ namespace GEX
 			auto finder = [this](ParticleNode& container, sf::Time)
 			{
 				if (container.getParticle() == type_)
-					particleSystem_ = &container;
+					particleSystem_ = container.getHandle();
 			};
 
 			Command command;
 			command.category = Category::ParticleSystem;
 			command.action = derivedAction<ParticleNode>(finder);
 
-			commands.push(command);
+			commands.push(std::move(command));
 		}
 	}
 
@@ -74,12 +76,14 @@ namespace GEX
 		const float EMISSION_RATE = 30.f;
 		const sf::Time interval = sf::seconds(1.f / EMISSION_RATE);
 
+		ParticleNode* particleSystem = getEntityRegistry()->get<ParticleNode>(particleSystem_);
+
 		accumulatedTime_ += dt;
 
 		while (accumulatedTime_ > interval)
 		{
 			accumulatedTime_ -= interval;
-			particleSystem_->addParticle(getWorldPosition());
+			particleSystem->addParticle(getWorldPosition());
 		}
 	}
 }
\ No newline at end of file
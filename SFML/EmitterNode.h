@@ -52,6 +52,6 @@ namespace GEX
 	private:
 		sf::Time			accumulatedTime_;
 		Particle::Type		type_;
-		ParticleNode*		particleSystem_;
+		EntityHandle		particleSystem_;
 	};
 }
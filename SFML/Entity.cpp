@@ -33,6 +33,7 @@
 */
 
 #include "Entity.h"
+#include "SpriteBatch.h"
 
 namespace GEX
 {
@@ -47,8 +48,7 @@ namespace GEX
 
 	void Entity::setVelocity(float vx, float vy)
 	{
-		velocity_.x = vx;
-		velocity_.y = vy;
+		setVelocity(sf::Vector2f(vx, vy));
 	}
 
 	sf::Vector2f Entity::getVelocity() const
@@ -58,18 +58,17 @@ namespace GEX
 
 	void Entity::accelerate(sf::Vector2f velocity)
 	{
-		velocity_ += velocity;
+		setVelocity(getVelocity() + velocity);
 	}
 
 	void Entity::accelerate(float vx, float vy)
 	{
-		velocity_.x += vx;
-		velocity_.y += vy;
+		accelerate(sf::Vector2f(vx, vy));
 	}
 
 	bool Entity::isDestroyed() const
 	{
-		return hitPoints_ <= 0;
+		return getHitpoints() <= 0;
 	}
 
 	void Entity::damage(int points)
@@ -103,7 +102,7 @@ namespace GEX
 	{
 		move(velocity_ * dt.asSeconds());
 	}
-	void Entity::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void Entity::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
 	{
 	}
 }
\ No newline at end of file
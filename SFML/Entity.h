@@ -44,28 +44,29 @@ namespace GEX
 	public:
 							Entity(int hp);
 
-		void				setVelocity(sf::Vector2f velocity);
+			//virtual so a subclass keeping its data elsewhere is reached through Entity& too
+		virtual void		setVelocity(sf::Vector2f velocity);
 		void				setVelocity(float vx, float vy);
 
-		sf::Vector2f		getVelocity() const;
+		virtual sf::Vector2f	getVelocity() const;
 
 		void				accelerate(sf::Vector2f velocity);
 		void				accelerate(float vx, float vy);
 
 		bool				isDestroyed() const override;
 
-		void				damage(int points);
-		void				repair(int points);
+		virtual void		damage(int points);
+		virtual void		repair(int points);
 		void				destroy();
 		virtual void		remove();
 
-		int					getHitpoints() const;
+		virtual int			getHitpoints() const;
 
 	protected:
 		 void				updateCurrent(sf::Time dt, CommandQueue& commands) override;
 
 	private:
-		virtual void		drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
+		virtual void		drawCurrent(SpriteBatch& batch, sf::RenderStates states) const;
 
 	private:
 		sf::Vector2f		velocity_;
@@ -0,0 +1,124 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* EntityRegistry Class
+* Hands out generational handles to scene nodes
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "EntityRegistry.h"
+#include "SceneNode.h"
+
+namespace GEX
+{
+	EntityHandle::EntityHandle()
+		: index(0)
+		, generation(0)
+	{
+	}
+
+	EntityHandle::EntityHandle(std::uint32_t index, std::uint32_t generation)
+		: index(index)
+		, generation(generation)
+	{
+	}
+
+	bool operator==(const EntityHandle& lhs, const EntityHandle& rhs)
+	{
+		return lhs.index == rhs.index && lhs.generation == rhs.generation;
+	}
+
+	bool operator!=(const EntityHandle& lhs, const EntityHandle& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	EntityRegistry::EntityRegistry()
+		: slots_()
+		, freeSlots_()
+		, size_(0)
+	{
+	}
+
+	EntityHandle EntityRegistry::create(SceneNode& node)
+	{
+		std::uint32_t index;
+
+		if (!freeSlots_.empty())
+		{
+			index = freeSlots_.back();
+			freeSlots_.pop_back();
+		}
+		else
+		{
+			// Generation 0 is reserved for the default, always invalid handle
+			index = static_cast<std::uint32_t>(slots_.size());
+			slots_.push_back(Slot{ nullptr, 1 });
+		}
+
+		slots_[index].node = &node;
+		++size_;
+
+		return EntityHandle(index, slots_[index].generation);
+	}
+
+	void EntityRegistry::release(EntityHandle handle)
+	{
+		if (!isValid(handle))
+			return;
+
+		Slot& slot = slots_[handle.index];
+		slot.node = nullptr;
+
+		// Skip 0 on wrap around so a default handle never becomes valid
+		if (++slot.generation == 0)
+			slot.generation = 1;
+
+		freeSlots_.push_back(handle.index);
+		--size_;
+	}
+
+	bool EntityRegistry::isValid(EntityHandle handle) const
+	{
+		return handle.index < slots_.size()
+			&& slots_[handle.index].generation == handle.generation
+			&& slots_[handle.index].node != nullptr;
+	}
+
+	SceneNode* EntityRegistry::get(EntityHandle handle) const
+	{
+		return isValid(handle) ? slots_[handle.index].node : nullptr;
+	}
+
+	std::size_t EntityRegistry::getSize() const
+	{
+		return size_;
+	}
+}
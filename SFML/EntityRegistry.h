@@ -0,0 +1,100 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* EntityRegistry Class
+* Hands out generational handles to scene nodes
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace GEX
+{
+	// forward declaration
+	class SceneNode;
+
+	// A slot index plus the generation of the slot when the handle was made,
+	// a handle goes stale as soon as its node is released
+	struct EntityHandle
+	{
+							EntityHandle();
+							EntityHandle(std::uint32_t index, std::uint32_t generation);
+
+		std::uint32_t		index;
+		std::uint32_t		generation;
+	};
+
+	bool operator==(const EntityHandle& lhs, const EntityHandle& rhs);
+	bool operator!=(const EntityHandle& lhs, const EntityHandle& rhs);
+
+	class EntityRegistry
+	{
+	public:
+									EntityRegistry();
+
+		EntityHandle				create(SceneNode& node);
+		void						release(EntityHandle handle);
+
+		bool						isValid(EntityHandle handle) const;
+		SceneNode*					get(EntityHandle handle) const;
+
+		template <typename GameObject>
+		GameObject*					get(EntityHandle handle) const;
+
+		std::size_t					getSize() const;
+
+	private:
+		struct Slot
+		{
+			SceneNode*				node;
+			std::uint32_t			generation;
+		};
+
+	private:
+		std::vector<Slot>			slots_;
+		std::vector<std::uint32_t>	freeSlots_;
+		std::size_t					size_;
+	};
+
+	template <typename GameObject>
+	GameObject* EntityRegistry::get(EntityHandle handle) const
+	{
+		SceneNode* node = get(handle);
+
+		// Check if cast is safe
+		assert(node == nullptr || dynamic_cast<GameObject*>(node) != nullptr);
+
+		return static_cast<GameObject*>(node);
+	}
+}
@@ -0,0 +1,203 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* FlowField Class
+* Grid of directions towards one target, shared by every zombie chasing it
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "FlowField.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+
+namespace GEX
+{
+	const std::uint32_t FlowField::Unreached;
+
+	FlowField::FlowField(const sf::FloatRect& area, float cellSize)
+		: area_(area)
+		, cellSize_(cellSize)
+		, columns_(static_cast<int>(std::ceil(area.width / cellSize)))
+		, rows_(static_cast<int>(std::ceil(area.height / cellSize)))
+		, blocked_(columns_ * rows_, false)
+		, distances_(columns_ * rows_, Unreached)
+		, directions_(columns_ * rows_)
+		, frontier_()
+		, targetCell_(0)
+		, isDirty_(true)
+	{
+		assert(cellSize > 0.f && columns_ > 0 && rows_ > 0);
+
+		frontier_.reserve(columns_ * rows_);
+	}
+
+	bool FlowField::update(sf::Vector2f target)
+	{
+		//off the grid, nothing leads there and chasers fall back to heading straight for the target
+		std::size_t cell = distances_.size();
+		cellIndex(target, cell);
+
+		if (!isDirty_ && cell == targetCell_)
+			return false;
+
+		rebuild(cell);
+		return true;
+	}
+
+	sf::Vector2f FlowField::getDirection(sf::Vector2f position) const
+	{
+		std::size_t cell;
+		if (!cellIndex(position, cell))
+			return sf::Vector2f(0.f, 0.f);
+
+		return directions_[cell];
+	}
+
+	void FlowField::setBlocked(const sf::FloatRect& area, bool blocked)
+	{
+		int left = std::max(0, static_cast<int>(std::floor((area.left - area_.left) / cellSize_)));
+		int top = std::max(0, static_cast<int>(std::floor((area.top - area_.top) / cellSize_)));
+		int right = std::min(columns_ - 1, static_cast<int>(std::floor((area.left + area.width - area_.left) / cellSize_)));
+		int bottom = std::min(rows_ - 1, static_cast<int>(std::floor((area.top + area.height - area_.top) / cellSize_)));
+
+		for (int y = top; y <= bottom; ++y)
+		{
+			for (int x = left; x <= right; ++x)
+				blocked_[y * columns_ + x] = blocked;
+		}
+
+		isDirty_ = true;
+	}
+
+	bool FlowField::isBlocked(sf::Vector2f position) const
+	{
+		std::size_t cell;
+		return cellIndex(position, cell) && blocked_[cell];
+	}
+
+	const sf::FloatRect& FlowField::getArea() const
+	{
+		return area_;
+	}
+
+	float FlowField::getCellSize() const
+	{
+		return cellSize_;
+	}
+
+	bool FlowField::cellIndex(sf::Vector2f position, std::size_t& index) const
+	{
+		int x = static_cast<int>(std::floor((position.x - area_.left) / cellSize_));
+		int y = static_cast<int>(std::floor((position.y - area_.top) / cellSize_));
+
+		if (x < 0 || y < 0 || x >= columns_ || y >= rows_)
+			return false;
+
+		index = static_cast<std::size_t>(y * columns_ + x);
+		return true;
+	}
+
+	void FlowField::rebuild(std::size_t targetCell)
+	{
+		targetCell_ = targetCell;
+		isDirty_ = false;
+
+		std::fill(distances_.begin(), distances_.end(), Unreached);
+		std::fill(directions_.begin(), directions_.end(), sf::Vector2f(0.f, 0.f));
+
+		if (targetCell >= distances_.size())
+			return;
+
+		const int targetX = static_cast<int>(targetCell % columns_);
+		const int targetY = static_cast<int>(targetCell / columns_);
+
+		//Breadth first, every step costs the same
+		frontier_.clear();
+		frontier_.push_back(targetCell);
+		distances_[targetCell] = 0;
+
+		for (std::size_t next = 0; next < frontier_.size(); ++next)
+		{
+			std::size_t cell = frontier_[next];
+			int x = static_cast<int>(cell % columns_);
+			int y = static_cast<int>(cell / columns_);
+
+			const int NEIGHBOURS[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+			for (const auto& offset : NEIGHBOURS)
+			{
+				int nx = x + offset[0];
+				int ny = y + offset[1];
+				if (nx < 0 || ny < 0 || nx >= columns_ || ny >= rows_)
+					continue;
+
+				std::size_t neighbour = static_cast<std::size_t>(ny * columns_ + nx);
+				if (blocked_[neighbour] || distances_[neighbour] != Unreached)
+					continue;
+
+				distances_[neighbour] = distances_[cell] + 1;
+				frontier_.push_back(neighbour);
+			}
+		}
+
+		//Each cell points at a closer neighbour; when both axes get closer the one with the longer
+		//way left wins, which keeps the horde's old habit of walking the dominant axis first
+		for (std::size_t cell : frontier_)
+		{
+			if (cell == targetCell)
+				continue;
+
+			int x = static_cast<int>(cell % columns_);
+			int y = static_cast<int>(cell / columns_);
+			std::uint32_t closer = distances_[cell] - 1;
+
+			sf::Vector2f horizontal(0.f, 0.f);
+			if (x > 0 && distances_[cell - 1] == closer)
+				horizontal.x = -1.f;
+			else if (x + 1 < columns_ && distances_[cell + 1] == closer)
+				horizontal.x = 1.f;
+
+			sf::Vector2f vertical(0.f, 0.f);
+			if (y > 0 && distances_[cell - columns_] == closer)
+				vertical.y = -1.f;
+			else if (y + 1 < rows_ && distances_[cell + columns_] == closer)
+				vertical.y = 1.f;
+
+			bool preferHorizontal = std::abs(targetX - x) > std::abs(targetY - y);
+
+			if (horizontal.x != 0.f && (preferHorizontal || vertical.y == 0.f))
+				directions_[cell] = horizontal;
+			else
+				directions_[cell] = vertical;
+		}
+	}
+}
@@ -0,0 +1,88 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* FlowField Class
+* Grid of directions towards one target, shared by every zombie chasing it
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace GEX
+{
+	// A breadth first search from the target's cell stores, per cell, the axis step towards
+	// the target. It is only rebuilt when the target moves to another cell or the obstacles
+	// change, so a chaser pays one lookup per tick. Blocked cells are walked around
+	class FlowField
+	{
+	public:
+										FlowField(const sf::FloatRect& area, float cellSize);
+
+			//rebuilds the field when the target changed cell, returns true if it did
+		bool							update(sf::Vector2f target);
+
+			//unit axis direction towards the target, zero in the target's cell,
+			//in blocked or unreachable cells and outside the area
+		sf::Vector2f					getDirection(sf::Vector2f position) const;
+
+		void							setBlocked(const sf::FloatRect& area, bool blocked);
+		bool							isBlocked(sf::Vector2f position) const;
+
+		const sf::FloatRect&			getArea() const;
+		float							getCellSize() const;
+
+	private:
+		static const std::uint32_t		Unreached = 0xffffffffu;
+
+	private:
+		bool							cellIndex(sf::Vector2f position, std::size_t& index) const;
+		void							rebuild(std::size_t targetCell);
+
+	private:
+		sf::FloatRect					area_;
+		float							cellSize_;
+		int								columns_;
+		int								rows_;
+
+		std::vector<bool>				blocked_;
+		std::vector<std::uint32_t>		distances_;
+		std::vector<sf::Vector2f>		directions_;
+		std::vector<std::size_t>		frontier_;
+
+		std::size_t						targetCell_;
+		bool							isDirty_;
+	};
+}
@@ -66,4 +66,11 @@ namespace GEX
 
 		return *found->second;
 	}
+
+	const sf::Font* GEX::FontManager::find(FontID id) const
+	{
+		auto found = fonts_.find(id);
+
+		return found != fonts_.end() ? found->second.get() : nullptr;
+	}
 }
\ No newline at end of file
@@ -36,7 +36,7 @@
 
 #include "ResourceIdentifiers.h"
 
-#include <SFML\Graphics\Font.hpp>
+#include <SFML/Graphics/Font.hpp>
 
 #include <memory>
 #include <map>
@@ -54,6 +54,7 @@ namespace GEX
 
 		void					load(FontID id, const std::string& path);
 		sf::Font&				get(FontID id) const;
+		const sf::Font*			find(FontID id) const;		// nullptr when the font was never loaded, e.g. headless
 
 	private:
 		static FontManager*							instance_;
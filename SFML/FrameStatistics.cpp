@@ -0,0 +1,258 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* FrameStatistics Class
+* Rolling frame and update times with a histogram for tail percentiles and a graph
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "FrameStatistics.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+namespace GEX
+{
+	namespace
+	{
+		const sf::Color FRAME_COLOR(80, 200, 80, 200);
+		const sf::Color HITCH_COLOR(230, 60, 60, 230);
+		const sf::Color UPDATE_COLOR(80, 140, 240, 220);
+		const sf::Color BUDGET_COLOR(255, 255, 255, 160);
+		const sf::Color BACKGROUND_COLOR(0, 0, 0, 140);
+
+		void addQuad(sf::VertexArray& vertices, float left, float top, float width, float height, sf::Color color)
+		{
+			vertices.append(sf::Vertex(sf::Vector2f(left, top), color));
+			vertices.append(sf::Vertex(sf::Vector2f(left + width, top), color));
+			vertices.append(sf::Vertex(sf::Vector2f(left + width, top + height), color));
+			vertices.append(sf::Vertex(sf::Vector2f(left, top + height), color));
+		}
+	}
+
+	const std::size_t FrameStatistics::SampleCount;
+	const std::size_t FrameStatistics::BucketCount;
+	const sf::Int64 FrameStatistics::BucketWidth = 250;
+
+	FrameStatistics::FrameStatistics(sf::Time budget)
+	: budget_(budget)
+	, samples_()
+	, histogram_()
+	, next_(0)
+	, count_(0)
+	, overBudget_(0)
+	, recorded_(0)
+	, graphSize_(300.f, 90.f)
+	, vertexArray_(sf::Quads)
+	, needsVertexUpdate_(true)
+	{
+	}
+
+	void FrameStatistics::record(sf::Time frameTime, sf::Time updateTime)
+	{
+		Sample& slot = samples_[next_];
+
+		//the oldest sample leaves the window
+		if (count_ == SampleCount)
+		{
+			--histogram_[getBucket(slot.frame)];
+			if (slot.frame > budget_)
+				--overBudget_;
+		}
+		else
+		{
+			++count_;
+		}
+
+		slot.frame = frameTime;
+		slot.update = updateTime;
+
+		++histogram_[getBucket(frameTime)];
+		if (frameTime > budget_)
+			++overBudget_;
+
+		next_ = (next_ + 1) % SampleCount;
+		++recorded_;
+		needsVertexUpdate_ = true;
+	}
+
+	std::size_t FrameStatistics::getSampleCount() const
+	{
+		return count_;
+	}
+
+	sf::Time FrameStatistics::getPercentile(float fraction) const
+	{
+		if (count_ == 0)
+			return sf::Time::Zero;
+
+		std::size_t rank = std::max<std::size_t>(static_cast<std::size_t>(std::ceil(fraction * count_)), 1);
+		std::size_t seen = 0;
+
+		for (std::size_t bucket = 0; bucket + 1 < BucketCount; ++bucket)
+		{
+			seen += histogram_[bucket];
+			if (seen >= rank)
+				return std::min(sf::microseconds((bucket + 1) * BucketWidth), getMax());
+		}
+
+		//The last bucket has no upper edge, so hitches are ranked exactly from the window
+		std::vector<sf::Time> hitches;
+		hitches.reserve(histogram_[BucketCount - 1]);
+
+		for (std::size_t age = 0; age < count_; ++age)
+		{
+			const sf::Time& frame = getSample(age).frame;
+			if (getBucket(frame) == BucketCount - 1)
+				hitches.push_back(frame);
+		}
+
+		auto nth = hitches.begin() + (rank - seen - 1);
+		std::nth_element(hitches.begin(), nth, hitches.end());
+
+		return *nth;
+	}
+
+	sf::Time FrameStatistics::getMax() const
+	{
+		sf::Time longest = sf::Time::Zero;
+
+		for (std::size_t age = 0; age < count_; ++age)
+			longest = std::max(longest, getSample(age).frame);
+
+		return longest;
+	}
+
+	std::size_t FrameStatistics::getOverBudgetCount() const
+	{
+		return overBudget_;
+	}
+
+	sf::Time FrameStatistics::getBudget() const
+	{
+		return budget_;
+	}
+
+	void FrameStatistics::setBudget(sf::Time budget)
+	{
+		budget_ = budget;
+		overBudget_ = 0;
+
+		for (std::size_t age = 0; age < count_; ++age)
+		{
+			if (getSample(age).frame > budget_)
+				++overBudget_;
+		}
+
+		needsVertexUpdate_ = true;
+	}
+
+	bool FrameStatistics::writeCsv(const std::string& path) const
+	{
+		std::ofstream out(path);
+		if (!out)
+			return false;
+
+		out << "frame,frame_ms,update_ms\n";
+
+		std::size_t first = recorded_ - count_;
+		for (std::size_t i = 0; i < count_; ++i)
+		{
+			const Sample& sample = getSample(count_ - 1 - i);
+			out << first + i << ","
+				<< sample.frame.asMicroseconds() / 1000.0 << ","
+				<< sample.update.asMicroseconds() / 1000.0 << "\n";
+		}
+
+		return static_cast<bool>(out);
+	}
+
+	void FrameStatistics::setGraphSize(sf::Vector2f size)
+	{
+		graphSize_ = size;
+		needsVertexUpdate_ = true;
+	}
+
+	void FrameStatistics::draw(sf::RenderTarget& target, sf::RenderStates states) const
+	{
+		if (needsVertexUpdate_)
+		{
+			computeVertices();
+			needsVertexUpdate_ = false;
+		}
+
+		states.transform *= getTransform();
+		target.draw(vertexArray_, states);
+	}
+
+	std::size_t FrameStatistics::getBucket(sf::Time time) const
+	{
+		sf::Int64 bucket = std::max<sf::Int64>(time.asMicroseconds(), 0) / BucketWidth;
+		return std::min(static_cast<std::size_t>(bucket), BucketCount - 1);
+	}
+
+	//age 0 is the most recent frame
+	const FrameStatistics::Sample& FrameStatistics::getSample(std::size_t age) const
+	{
+		return samples_[(next_ + SampleCount - 1 - age) % SampleCount];
+	}
+
+	//Frame time bars with the update share drawn over them, newest on the right. Bars are
+	//clamped to the graph, which spans three frame budgets so hitches still stand out
+	void FrameStatistics::computeVertices() const
+	{
+		vertexArray_.clear();
+
+		const float barWidth = graphSize_.x / SampleCount;
+		const float scale = graphSize_.y / (3.f * budget_.asSeconds());
+
+		addQuad(vertexArray_, 0.f, 0.f, graphSize_.x, graphSize_.y, BACKGROUND_COLOR);
+
+		for (std::size_t age = 0; age < count_; ++age)
+		{
+			const Sample& sample = getSample(age);
+			float left = graphSize_.x - (age + 1) * barWidth;
+
+			float frameHeight = std::min(sample.frame.asSeconds() * scale, graphSize_.y);
+			float updateHeight = std::min(sample.update.asSeconds() * scale, frameHeight);
+			sf::Color color = sample.frame > budget_ ? HITCH_COLOR : FRAME_COLOR;
+
+			addQuad(vertexArray_, left, graphSize_.y - frameHeight, barWidth, frameHeight, color);
+			addQuad(vertexArray_, left, graphSize_.y - updateHeight, barWidth, updateHeight, UPDATE_COLOR);
+		}
+
+		float budgetTop = graphSize_.y - budget_.asSeconds() * scale;
+		addQuad(vertexArray_, 0.f, budgetTop, graphSize_.x, 1.f, BUDGET_COLOR);
+	}
+}
@@ -0,0 +1,109 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* FrameStatistics Class
+* Rolling frame and update times with a histogram for tail percentiles and a graph
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <string>
+
+namespace GEX
+{
+	// Keeps the last SampleCount frames. Percentiles come from a fixed bucket histogram that is
+	// updated as samples enter and leave the window; only ranks in the open ended last bucket,
+	// the hitches, are picked exactly from the window
+	class FrameStatistics : public sf::Drawable, public sf::Transformable
+	{
+	public:
+		static const std::size_t	SampleCount = 600;
+		static const std::size_t	BucketCount = 200;
+		static const sf::Int64		BucketWidth;			//microseconds, the last bucket also takes everything slower
+
+	public:
+		explicit					FrameStatistics(sf::Time budget);
+
+		void						record(sf::Time frameTime, sf::Time updateTime);
+
+		std::size_t					getSampleCount() const;
+
+			//frame time below which the given fraction of the window falls, rounded up to a bucket edge
+			//below BucketCount * BucketWidth and exact above it
+		sf::Time					getPercentile(float fraction) const;
+		sf::Time					getMax() const;
+		std::size_t					getOverBudgetCount() const;
+		sf::Time					getBudget() const;
+
+			//recounts the frames over budget already in the window
+		void						setBudget(sf::Time budget);
+
+			//the window as frame,frame_ms,update_ms rows, oldest first
+		bool						writeCsv(const std::string& path) const;
+
+			//one bar per sample, the budget line sits at a third of the height
+		void						setGraphSize(sf::Vector2f size);
+
+	private:
+		struct Sample
+		{
+			sf::Time				frame;
+			sf::Time				update;
+		};
+
+	private:
+		void						draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+		std::size_t					getBucket(sf::Time time) const;
+		const Sample&				getSample(std::size_t age) const;
+		void						computeVertices() const;
+
+	private:
+		sf::Time					budget_;
+
+		std::array<Sample, SampleCount>			samples_;
+		std::array<std::size_t, BucketCount>	histogram_;
+		std::size_t					next_;
+		std::size_t					count_;
+		std::size_t					overBudget_;
+		std::size_t					recorded_;
+
+		sf::Vector2f				graphSize_;
+		mutable sf::VertexArray		vertexArray_;
+		mutable bool				needsVertexUpdate_;
+	};
+}
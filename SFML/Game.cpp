@@ -33,6 +33,7 @@
 */
 
 #include "Game.h"
+#include <random>
 #include <string>
 
 namespace
@@ -50,7 +51,7 @@ namespace GEX
 
 	Game::Game()
 		: window_(sf::VideoMode(1680, 1050), "Boxhead")
-		, world_(window_, sounds_)
+		, world_(window_, sounds_, std::random_device()())
 		, statisticsText_()
 		, statisticsUpdateTime_(sf::Time::Zero)
 		, statisticsNumFrames_(0)
@@ -35,22 +35,63 @@
 #include "GameState.h"
 #include "CommandQueue.h"
 
+#include <iostream>
+#include <random>
+
+namespace
+{
+	std::unique_ptr<GEX::ReplayPlayer> loadReplay(const std::string& path)
+	{
+		if (path.empty())
+			return nullptr;
+
+		return std::unique_ptr<GEX::ReplayPlayer>(new GEX::ReplayPlayer(path));
+	}
+}
+
 GameState::GameState(GEX::StateStack& stateStack, Context context)
 	: State(stateStack, context)
-	, world_(*context.window, *context.sound_)
 	, player_(*context.player)
+	, replay_(loadReplay(player_.getReplayPath()))
+	, world_(*context.window, *context.sound_, replay_ ? replay_->getSeed() : std::random_device()())
+	, recorder_()
 {
+	if (!replay_ && !player_.getRecordPath().empty())
+	{
+		recorder_.reset(new GEX::ReplayRecorder(player_.getRecordPath(), world_.getSeed()));
+		player_.setRecorder(recorder_.get());
+	}
+
 	context.music_->play(GEX::MusicID::GameTheme);
 	context.music_->setVolume(15.f);
 }
 
+GameState::~GameState()
+{
+	player_.setRecorder(nullptr);
+}
+
 void GameState::draw()
 {
 	world_.draw();
 }
 
+void GameState::setInterpolation(float alpha)
+{
+	world_.setInterpolation(alpha);
+}
+
 bool GameState::update(sf::Time dt)
 {
+	if (isReplaying())
+		advanceReplay(dt);
+	else if (recorder_)
+	{
+		if (recorder_->isKeyframeDue())
+			recorder_->setKeyframe(world_.computeChecksum());
+		recorder_->endTick(dt);
+	}
+
 		//update the world and handle player inputs
 	world_.update(dt, world_.getCommandQueue());
 
@@ -67,7 +108,8 @@ bool GameState::update(sf::Time dt)
 
 	//GEX::CommandQueue& commands = world_.getCommandQueue();
 	auto& commands = world_.getCommandQueue();
-	player_.handleRealtimeInput(commands);
+	if (!isReplaying())
+		player_.handleRealtimeInput(commands);
 
 	return true;
 }
@@ -75,7 +117,8 @@ bool GameState::update(sf::Time dt)
 bool GameState::handleEvent(const sf::Event & event)
 {
 	auto& commands = world_.getCommandQueue();
-	player_.handleEvent(event, commands);
+	if (!isReplaying())
+		player_.handleEvent(event, commands);
 
 		//'Escape' and 'P' keys bring up pause screen, 'G' key brings up GEX screen, 'Q' key returns player to main menu instantly
 	if (event.type == sf::Event::KeyPressed && (event.key.code == sf::Keyboard::Escape || event.key.code == sf::Keyboard::P))
@@ -89,4 +132,20 @@ bool GameState::handleEvent(const sf::Event & event)
 	}
 
 	return true;
-}
\ No newline at end of file
+}
+
+bool GameState::isReplaying() const
+{
+	return replay_ && !replay_->isFinished();
+}
+
+void GameState::advanceReplay(sf::Time& dt)
+{
+		//the recorded tick length, a different one would take the world down another path
+	dt = replay_->getTimePerTick();
+
+	if (replay_->hasKeyframe() && replay_->getKeyframeChecksum() != world_.computeChecksum())
+		std::cerr << "Replay desynced at tick " << replay_->getTick() << "\n";
+
+	replay_->feed(world_.getCommandQueue());
+}
@@ -37,18 +37,30 @@
 #include "State.h"
 #include "World.h"
 #include "PlayerControl.h"
+#include "Replay.h"
+
+#include <memory>
 
 class GameState : public GEX::State
 {
 public:
 	GameState(GEX::StateStack& stateStack, Context context);
+	~GameState();
 	
 	void					draw() override;
 	bool					update(sf::Time dt);
 	bool					handleEvent(const sf::Event& event) override;
+	void					setInterpolation(float alpha) override;
 
 private:
-	GEX::World				world_;
+	bool					isReplaying() const;
+	void					advanceReplay(sf::Time& dt);
+
+private:
+	// The replay is loaded before the world so the world can take its seed
 	GEX::PlayerControl&		player_;
+	std::unique_ptr<GEX::ReplayPlayer>		replay_;
+	GEX::World				world_;
+	std::unique_ptr<GEX::ReplayRecorder>	recorder_;
 };
 
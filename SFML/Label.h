@@ -37,7 +37,7 @@
 #include "Component.h"
 #include "TextureManager.h"
 
-#include <SFML\Graphics\Text.hpp>
+#include <SFML/Graphics/Text.hpp>
 
 namespace GUI
 { 
@@ -34,7 +34,7 @@
 
 #pragma once
 
-#include <SFML\Audio\Music.hpp>
+#include <SFML/Audio/Music.hpp>
 
 #include "ResourceIdentifiers.h"
 #include <map>
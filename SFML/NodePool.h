@@ -0,0 +1,178 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* NodePool Class
+* Preallocated, recycled storage for frequently spawned scene nodes
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace GEX
+{
+	// Fixed-size block pool backing the class specific operator new / delete of a node type.
+	// Freed nodes hand their block back to the pool and the next spawn constructs into it.
+	template <typename T>
+	class NodePool
+	{
+	public:
+		static NodePool&				getInstance();
+
+		void							reserve(std::size_t capacity);
+
+		void*							allocate(std::size_t size);
+		void							deallocate(void* block, std::size_t size);
+
+		std::size_t						getCapacity() const;
+		std::size_t						getOccupancy() const;
+		std::size_t						getHighWaterMark() const;
+
+	private:
+										NodePool();
+										NodePool(const NodePool&) = delete;
+		NodePool&						operator=(const NodePool&) = delete;
+
+		void							grow(std::size_t count);
+
+	private:
+		using Block = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+		static const std::size_t		MinimumGrowth = 16;
+
+	private:
+		std::vector<std::unique_ptr<Block[]>>	chunks_;
+		std::vector<void*>						freeBlocks_;
+
+		std::size_t						capacity_;
+		std::size_t						occupancy_;
+		std::size_t						highWaterMark_;
+	};
+
+	template <typename T>
+	const std::size_t NodePool<T>::MinimumGrowth;
+
+	template <typename T>
+	NodePool<T>& NodePool<T>::getInstance()
+	{
+		static NodePool instance;
+		return instance;
+	}
+
+	template <typename T>
+	NodePool<T>::NodePool()
+		: chunks_()
+		, freeBlocks_()
+		, capacity_(0)
+		, occupancy_(0)
+		, highWaterMark_(0)
+	{
+	}
+
+	template <typename T>
+	void NodePool<T>::reserve(std::size_t capacity)
+	{
+		if (capacity > capacity_)
+			grow(capacity - capacity_);
+	}
+
+	template <typename T>
+	void* NodePool<T>::allocate(std::size_t size)
+	{
+		// Derived types are bigger than a block, leave them to the heap
+		if (size != sizeof(T))
+			return ::operator new(size);
+
+		if (freeBlocks_.empty())
+			grow(std::max(capacity_ / 2, MinimumGrowth));
+
+		void* block = freeBlocks_.back();
+		freeBlocks_.pop_back();
+
+		++occupancy_;
+		highWaterMark_ = std::max(highWaterMark_, occupancy_);
+
+		return block;
+	}
+
+	template <typename T>
+	void NodePool<T>::deallocate(void* block, std::size_t size)
+	{
+		if (size != sizeof(T))
+		{
+			::operator delete(block);
+			return;
+		}
+
+		assert(occupancy_ > 0);
+
+		freeBlocks_.push_back(block);
+		--occupancy_;
+	}
+
+	template <typename T>
+	std::size_t NodePool<T>::getCapacity() const
+	{
+		return capacity_;
+	}
+
+	template <typename T>
+	std::size_t NodePool<T>::getOccupancy() const
+	{
+		return occupancy_;
+	}
+
+	template <typename T>
+	std::size_t NodePool<T>::getHighWaterMark() const
+	{
+		return highWaterMark_;
+	}
+
+	template <typename T>
+	void NodePool<T>::grow(std::size_t count)
+	{
+		std::unique_ptr<Block[]> chunk(new Block[count]);
+
+		freeBlocks_.reserve(capacity_ + count);
+
+		// Push in reverse so blocks are handed out in address order
+		for (std::size_t i = count; i > 0; --i)
+			freeBlocks_.push_back(&chunk[i - 1]);
+
+		chunks_.push_back(std::move(chunk));
+		capacity_ += count;
+	}
+}
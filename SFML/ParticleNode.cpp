@@ -34,6 +34,9 @@
 
 #include "ParticleNode.h"
 #include "DataTables.h"
+#include "SpriteBatch.h"
+
+#include <algorithm>
 
 namespace GEX
 { 
@@ -45,7 +48,8 @@ namespace GEX
 	ParticleNode::ParticleNode(Particle::Type type, const TextureManager& textures)
 		: SceneNode()
 		, particles_()
-		, texture_(textures.get(GEX::TextureID::Particle))
+		, texture_(textures.find(GEX::TextureID::Particle))
+		, textureSize_(static_cast<float>(textures.getTextureRect(GEX::TextureID::Particle).width), static_cast<float>(textures.getTextureRect(GEX::TextureID::Particle).height))
 		, type_(type)
 		, vertexArray_(sf::Quads)
 		, needsVertexUpdate_(true)
@@ -60,7 +64,7 @@ namespace GEX
 		particle.lifetime = TABLE.at(type_).lifetime;
 
 		particles_.push_back(particle);
-
+		invalidateBoundingBox();
 	}
 
 	Particle::Type ParticleNode::getParticle() const
@@ -75,6 +79,8 @@ namespace GEX
 
 	void ParticleNode::updateCurrent(sf::Time dt, CommandQueue & commands)
 	{
+		const bool hadParticles = !particles_.empty();
+
 		// Remove aged out particles
 		while (!particles_.empty() && particles_.front().lifetime <= sf::Time::Zero)
 			particles_.pop_front();
@@ -85,20 +91,48 @@ namespace GEX
 
 		// Mark for update
 		needsVertexUpdate_ = true;
+
+		if (hadParticles)
+			invalidateBoundingBox();
 	}
 
-	void ParticleNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	sf::FloatRect ParticleNode::computeDrawBounds() const
+	{
+		if (particles_.empty())
+			return sf::FloatRect();
+
+		sf::Vector2f half = textureSize_ / 2.f;
+		sf::Vector2f minimum = particles_.front().position;
+		sf::Vector2f maximum = minimum;
+
+		for (const Particle& p : particles_)
+		{
+			minimum.x = std::min(minimum.x, p.position.x);
+			minimum.y = std::min(minimum.y, p.position.y);
+			maximum.x = std::max(maximum.x, p.position.x);
+			maximum.y = std::max(maximum.y, p.position.y);
+		}
+
+		return getWorldTransform().transformRect(sf::FloatRect(minimum - half, maximum - minimum + 2.f * half));
+	}
+
+	const sf::VertexArray& ParticleNode::getVertices() const
 	{
 		if (needsVertexUpdate_)
 		{
 			computeVertices();
 			needsVertexUpdate_ = false;
 		}
-		
-		states.texture = &texture_;
+
+		return vertexArray_;
+	}
+
+	void ParticleNode::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
+	{
+		states.texture = texture_;
 
 		// Draw all the vertices
-		target.draw(vertexArray_, states);
+		batch.draw(getVertices(), states);
 	}
 
 	void ParticleNode::addVertex(float worldX, float worldY, float texCoordU, float texCoordV, const sf::Color color) const
@@ -114,7 +148,7 @@ namespace GEX
 
 	void ParticleNode::computeVertices() const
 	{
-		sf::Vector2f size(texture_.getSize());
+		sf::Vector2f size(textureSize_);
 		sf::Vector2f half = size / 2.f;
 
 		// Refill vertex array
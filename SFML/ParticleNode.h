@@ -53,16 +53,23 @@ namespace GEX
 		Particle::Type		getParticle() const;
 		unsigned int		getCategory() const override;
 
+			//particle quads, rebuilt when the particles changed since the last call
+		const sf::VertexArray&	getVertices() const;
+
+	protected:
+		sf::FloatRect		computeDrawBounds() const override;
+
 	private:
 		void				updateCurrent(sf::Time dt, CommandQueue& commands) override;
-		void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void				drawCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
 		void				addVertex(float worldX, float worldY, float texCoordU, float texCoordV, const sf::Color color) const;
 		void				computeVertices() const;
 
 	private:
 		std::deque<Particle>	particles_;
-		const sf::Texture&		texture_;
+		const sf::Texture*		texture_;
+		sf::Vector2f			textureSize_;
 		Particle::Type			type_;
 
 		mutable	sf::VertexArray vertexArray_;
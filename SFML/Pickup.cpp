@@ -35,6 +35,8 @@
 #include "Pickup.h"
 #include "DataTables.h"
 #include "Utility.h"
+#include "NodePool.h"
+#include "SpriteBatch.h"
 
 namespace GEX
 { 
@@ -46,15 +48,23 @@ namespace GEX
 	Pickup::Pickup(Type type, const TextureManager& textures)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, sprite_(textures.createSprite(TABLE.at(type).texture, TABLE.at(type).textureRect))
 	{
 		centerOrigin(sprite_);
 	}
+	void* Pickup::operator new(std::size_t size)
+	{
+		return NodePool<Pickup>::getInstance().allocate(size);
+	}
+	void Pickup::operator delete(void* block, std::size_t size)
+	{
+		NodePool<Pickup>::getInstance().deallocate(block, size);
+	}
 	unsigned int Pickup::getCategory() const
 	{
 		return Category::Pickup;
 	}
-	sf::FloatRect Pickup::getBoundingBox() const
+	sf::FloatRect Pickup::computeBoundingBox() const
 	{
 		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
 	}
@@ -62,8 +72,8 @@ namespace GEX
 	{
 		TABLE.at(type_).action(player);
 	}
-	void Pickup::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void Pickup::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
 	{
-		target.draw(sprite_, states);
+		batch.draw(sprite_, states);
 	}
 }
\ No newline at end of file
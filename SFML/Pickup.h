@@ -57,12 +57,15 @@ namespace GEX
 						Pickup(Type type, const TextureManager& textures);
 						~Pickup() = default;
 
+		static void*	operator new(std::size_t size);
+		static void		operator delete(void* block, std::size_t size);
+
 		unsigned int	getCategory() const override;
-		sf::FloatRect	getBoundingBox() const override;
 		void			apply(Player& player);
 
 	private:
-		void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		sf::FloatRect	computeBoundingBox() const override;
+		void			drawCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
 	private:
 		Type			type_;
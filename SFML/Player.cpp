@@ -39,10 +39,10 @@
 #include "TextNode.h"
 #include "SoundNode.h"
 #include "CommandQueue.h"
+#include "SpriteBatch.h"
 
 #include <string>
 
-using namespace std::placeholders;
 
 namespace GEX
 { 
@@ -54,16 +54,9 @@ namespace GEX
 	Player::Player(Player::Type type, const TextureManager& textures)
 		: Entity(TABLE.at(type).hitpoints)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
-		, death_(textures.get(TextureID::PlayerDeath))
-		, walkUp_(textures.get(TextureID::PlayerWalkUp))
-		, walkLeft_(textures.get(TextureID::PlayerWalkLeft))
-		, walkDown_(textures.get(TextureID::PlayerWalkDown))
-		, walkRight_(textures.get(TextureID::PlayerWalkRight))
-		, idleUp_(textures.get(TextureID::PlayerIdleUp))
-		, idleLeft_(textures.get(TextureID::PlayerIdleLeft))
-		, idleDown_(textures.get(TextureID::PlayerIdleDown))
-		, idleRight_(textures.get(TextureID::PlayerIdleRight))
+		, sprite_(textures.createSprite(TABLE.at(type).texture, TABLE.at(type).textureRect))
+		, animation_(nullptr)
+		, stateTime_(sf::Time::Zero)
 		, showDeath_(true)
 		, healthDisplay_(nullptr)
 		, ammoDisplay_(nullptr)
@@ -71,22 +64,11 @@ namespace GEX
 		, isMarkedForRemoval_(false)
 		, ammo_(250)
 		, fireCountDown_(sf::Time::Zero)
-		, fireCommand_()
+		, textures_(textures)
 		, state_(Player::State::IdleDown)
 	{
-		setupAnimations();
-
-		centerOrigin(idleUp_);
-		centerOrigin(idleLeft_);
-		centerOrigin(idleDown_);
-		centerOrigin(idleRight_);
-
-		//Set up Commands
-		fireCommand_.category = Category::GroundLayer;
-		fireCommand_.action = [this, &textures] (SceneNode& node, sf::Time dt) 
-		{
-			createBullets(node, textures);
-		};
+		centerOrigin(sprite_);
+		playStateAnimation();
 
 		//set up text for health and missiles
 		std::unique_ptr<TextNode> health(new TextNode(""));
@@ -139,7 +121,7 @@ namespace GEX
 		ammo_ += count;
 	}
 
-	sf::FloatRect Player::getBoundingBox() const
+	sf::FloatRect Player::computeBoundingBox() const
 	{
 		auto box = getWorldTransform().transformRect(sprite_.getGlobalBounds());
 
@@ -153,7 +135,7 @@ namespace GEX
 
 	bool Player::isMarkedForRemoval() const
 	{
-		return isDestroyed() && (death_.isFinished() || !showDeath_);
+		return isDestroyed() && ((state_ == Player::State::Dead && animation_ && animation_->isFinished(stateTime_)) || !showDeath_);
 	}
 
 	void Player::remove()
@@ -166,11 +148,12 @@ namespace GEX
 	{
 		Command playSoundCommand;
 		playSoundCommand.category = Category::SoundEffect;
-		playSoundCommand.action = derivedAction<SoundNode>(
-			std::bind(&SoundNode::playSound, _1, effect, getWorldPosition())
-			);
+		playSoundCommand.action = derivedAction<SoundNode>([effect, position = getWorldPosition()](SoundNode& node, sf::Time)
+		{
+			node.playSound(effect, position);
+		});
 
-		commands.push(playSoundCommand);
+		commands.push(std::move(playSoundCommand));
 	}
 
 	void Player::updateCurrent(sf::Time dt, CommandQueue& commands)
@@ -179,28 +162,7 @@ namespace GEX
 		checkProjectileLaunch(dt, commands);
 
 		updateStates(dt);
-
-		switch (state_)
-		{
-			case Player::State::Dead:
-				death_.update(dt);
-				break;
-			case Player::State::WalkDown:
-				walkDown_.update(dt);
-				break;
-			case Player::State::WalkUp:
-				walkUp_.update(dt);
-				break;
-			case Player::State::WalkLeft:
-				walkLeft_.update(dt);
-				break;
-			case Player::State::WalkRight:
-				walkRight_.update(dt);
-				break;
-			default:
-				//Do Nothing
-				break;
-		}
+		stateTime_ += dt;
 
 		Entity::updateCurrent(dt, commands);
 
@@ -263,7 +225,12 @@ namespace GEX
 
 	void Player::setState(Player::State state)
 	{
+		if (state_ == state)
+			return;
+
 		state_ = state;
+		stateTime_ = sf::Time::Zero;
+		playStateAnimation();
 	}
 
 	Player::State Player::getState() const
@@ -354,7 +321,14 @@ namespace GEX
 			//Can only fire if player has ammo
 			if (ammo_ > 0)
 			{ 
-				commands.push(fireCommand_);
+				Command fireCommand;
+				fireCommand.category = Category::GroundLayer;
+				fireCommand.action = [this](SceneNode& node, sf::Time dt)
+				{
+					createBullets(node, textures_);
+				};
+				commands.push(std::move(fireCommand));
+
 				playLocalSound(commands, SoundEffectID::PistolShot);
 				isFiring_ = false;
 				--ammo_;
@@ -367,80 +341,20 @@ namespace GEX
 		}
 	}
 
-	void Player::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void Player::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
 	{
-		switch (state_)
-		{
-			case Player::State::Dead:
-				target.draw(death_, states);
-				break;
-			case Player::State::WalkRight:
-				target.draw(walkRight_, states);
-				break;
-			case Player::State::WalkLeft:
-				target.draw(walkLeft_, states);
-				break;
-			case Player::State::WalkDown:
-				target.draw(walkDown_, states);
-				break;
-			case Player::State::WalkUp:
-				target.draw(walkUp_, states);
-				break;
-			case Player::State::IdleUp:
-				target.draw(idleUp_, states);
-				break;
-			case Player::State::IdleLeft:
-				target.draw(idleLeft_, states);
-				break;
-			case Player::State::IdleDown:
-				target.draw(idleDown_, states);
-				break;
-			case Player::State::IdleRight:
-				target.draw(idleRight_, states);
-				break;
-			default:
-				//Do Nothing
-				target.draw(sprite_, states);
-				break;
-		}
+		if (animation_)
+			batch.draw(*animation_, stateTime_, states);
+		else
+			batch.draw(sprite_, states);
 	}
 
-	void Player::setupAnimations() 
+	//Every state has its own clip, which starts with the state, so the state time is the clip time
+	void Player::playStateAnimation()
 	{
-		//Death
-		death_.setFrameSize(sf::Vector2i(35, 39));
-		death_.setNumFrames(4);
-		death_.setDuration(sf::seconds(1));
-
-		//Walk Up
-		walkUp_.setFrameSize(sf::Vector2i(27, 39));
-		walkUp_.setNumFrames(7);
-		walkUp_.setDuration(sf::seconds(1.5));
-		walkUp_.setRepeating(true);
-
-		//Walk Left
-		walkLeft_.setFrameSize(sf::Vector2i(30, 39));
-		walkLeft_.setNumFrames(7);
-		walkLeft_.setDuration(sf::seconds(1.5));
-		walkLeft_.setRepeating(true);
-
-		//Walk Down
-		walkDown_.setFrameSize(sf::Vector2i(26, 39));
-		walkDown_.setNumFrames(7);
-		walkDown_.setDuration(sf::seconds(1.5));
-		walkDown_.setRepeating(true);
-
-		//Walk Right
-		walkRight_.setFrameSize(sf::Vector2i(30, 39));
-		walkRight_.setNumFrames(7);
-		walkRight_.setDuration(sf::seconds(1.5));
-		walkRight_.setRepeating(true);
-
-		centerOrigin(death_);
-		centerOrigin(sprite_);
-		centerOrigin(walkUp_);
-		centerOrigin(walkLeft_);
-		centerOrigin(walkDown_);
-		centerOrigin(walkRight_);
+		const auto& animations = TABLE.at(type_).animations;
+		auto found = animations.find(state_);
+
+		animation_ = found != animations.end() ? &textures_.getClip(found->second) : nullptr;
 	}
 }
\ No newline at end of file
@@ -34,7 +34,7 @@
 
 #pragma once
 
-#include <SFML\Graphics\Sprite.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
 #include "Entity.h"
 #include "Command.h"
@@ -42,7 +42,7 @@
 #include "TextureManager.h"
 #include "Projectile.h"
 #include "TextNode.h"
-#include "Animation.h"
+#include "AnimationClip.h"
 
 namespace GEX
 {
@@ -70,7 +70,7 @@ namespace GEX
 	public:
 								Player(Player::Type type, const TextureManager& textures);
 		
-		void					drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void					drawCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 		unsigned int			getCategory() const override;
 
 		//bool					isAllied() const;
@@ -81,7 +81,6 @@ namespace GEX
 		//void					increaseFireRate();
 		//void					increaseFireSpread();
 		void					collectAmmo(unsigned int count);
-		sf::FloatRect			getBoundingBox() const override;
 
 		bool					isMarkedForRemoval() const override;
 
@@ -90,13 +89,14 @@ namespace GEX
 		void					playLocalSound(CommandQueue& commands, SoundEffectID effect);
 
 	protected:
+		sf::FloatRect			computeBoundingBox() const override;
 		void					updateCurrent(sf::Time dt, CommandQueue& commands) override;
 
 	private:
 		//void					updateMovementPattern(sf::Time dt);
 		float					getMaxSpeed() const;
 
-		void					setupAnimations();
+		void					playStateAnimation();
 
 		void					updateStates(sf::Time dt);
 
@@ -117,19 +117,10 @@ namespace GEX
 	private:
 		Type					type_;
 		sf::Sprite				sprite_;
-		Animation				death_;
+		const AnimationClip*	animation_;		// shared through textures_, starts with the state
+		sf::Time				stateTime_;
 		bool					showDeath_;
 
-		Animation				walkUp_;
-		Animation				walkLeft_;
-		Animation				walkDown_;
-		Animation				walkRight_;
-
-		sf::Sprite				idleUp_;
-		sf::Sprite				idleLeft_;
-		sf::Sprite				idleDown_;
-		sf::Sprite				idleRight_;
-
 		TextNode*				healthDisplay_;
 		TextNode*				ammoDisplay_;
 
@@ -146,7 +137,7 @@ namespace GEX
 
 		sf::Time				fireCountDown_;
 
-		Command					fireCommand_;
+		const TextureManager&	textures_;		// bullets are built from it when a fire command runs
 		//Command					launchMissileCommand_;
 		//Command					dropPickupCommand_;
 
@@ -0,0 +1,103 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* PlayerAction
+* What the player can ask of the simulation, and the command each action becomes
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "PlayerAction.h"
+#include "Player.h"
+#include "Category.h"
+
+namespace GEX
+{
+	namespace
+	{
+		const float PLAYER_SPEED = 200.f;
+
+		struct AircraftMover
+		{
+		public:
+
+			AircraftMover(float vx, float vy)
+				: velocity(vx, vy)
+			{}
+
+			void operator() (Player& aircraft, sf::Time dt) const
+			{
+				aircraft.accelerate(velocity);
+			}
+
+			sf::Vector2f velocity;
+		};
+	}
+
+	Command makeActionCommand(Action action)
+	{
+		Command command;
+		command.category = Category::Player;
+
+		switch (action)
+		{
+			case Action::MoveLeft:
+				command.action = derivedAction<Player>(AircraftMover(-PLAYER_SPEED, 0.f));
+				break;
+			case Action::MoveRight:
+				command.action = derivedAction<Player>(AircraftMover(PLAYER_SPEED, 0.f));
+				break;
+			case Action::MoveUp:
+				command.action = derivedAction<Player>(AircraftMover(0.f, -PLAYER_SPEED));
+				break;
+			case Action::MoveDown:
+				command.action = derivedAction<Player>(AircraftMover(0.f, PLAYER_SPEED));
+				break;
+			case Action::Fire:
+				command.action = derivedAction<Player>([](Player& node, sf::Time dt) {node.fire(); });
+				break;
+			// rotate raptors
+			case Action::RR:
+				command.action = derivedAction<Player>([](Player& node, sf::Time dt) {node.rotate(+10.f); });
+				command.category = Category::EnemyAircraft;
+				break;
+			case Action::RL:
+				command.action = derivedAction<Player>([](Player& node, sf::Time dt) {node.rotate(-10.f); });
+				command.category = Category::EnemyAircraft;
+				break;
+			default:
+				//launchMissile is not implemented, the command reaches nobody
+				command.action = [](SceneNode&, sf::Time) {};
+				command.category = Category::None;
+				break;
+		}
+
+		return command;
+	}
+}
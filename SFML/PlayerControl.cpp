@@ -37,28 +37,16 @@
 #include "Command.h"
 #include "Category.h"
 #include "CommandQueue.h"
+#include "Replay.h"
 
 
 namespace GEX
 { 
-	struct AircraftMover
-	{
-	public:
-
-		AircraftMover(float vx, float vy)
-			: velocity(vx, vy)
-		{}
-
-		void operator() (Player& aircraft, sf::Time dt) const
-		{
-			aircraft.accelerate(velocity);
-		}
-
-		sf::Vector2f velocity;
-	};
-
 	PlayerControl::PlayerControl()
 		: currentMissionStatus_(MissionStatus::MissionRunning)
+		, recorder_(nullptr)
+		, recordPath_()
+		, replayPath_()
 	{
 		// set up key bindings
 		keyBindings_[sf::Keyboard::Left] = Action::MoveLeft;
@@ -69,25 +57,9 @@ namespace GEX
 		keyBindings_[sf::Keyboard::Space] = Action::Fire;
 		//keyBindings_[sf::Keyboard::M] = Action::LaunchMissile;
 
-		// set up action bindings
-		initializeActions();
-
-		for (auto& pair : actionBindings_)
-			pair.second.category = Category::Player;
-
 		// rotate raptors
 		keyBindings_[sf::Keyboard::R] = Action::RR;
 		keyBindings_[sf::Keyboard::L] = Action::RL;
-		actionBindings_[Action::RR].action = derivedAction<Player>([](Player& node, sf::Time dt) {node.rotate(+10.f); });
-		actionBindings_[Action::RL].action = derivedAction<Player>([](Player& node, sf::Time dt) {node.rotate(-10.f); });
-		actionBindings_[Action::RR].category = Category::EnemyAircraft;
-		actionBindings_[Action::RL].category = Category::EnemyAircraft;
-
-		//actionBindings_[Action::Fire].action = derivedAction<Aircraft>(std::bind(&Aircraft::fire, std::placeholders::_1));
-		actionBindings_[Action::Fire].category = Category::Player;
-
-		//actionBindings_[Action::LaunchMissile].action = derivedAction<Aircraft>(std::bind(&Aircraft::launchMissile, std::placeholders::_1));
-		//actionBindings_[Action::LaunchMissile].category = Category::Player;
 	}
 
 	void PlayerControl::handleEvent(const sf::Event & event, CommandQueue & commands)
@@ -98,7 +70,7 @@ namespace GEX
 
 			if (found != keyBindings_.end())
 			{
-				commands.push(actionBindings_[found->second]);
+				pushAction(found->second, commands);
 			}
 		}
 	}
@@ -110,7 +82,7 @@ namespace GEX
 		{
 			if (sf::Keyboard::isKeyPressed(pair.first) && isRealTimeAction(pair.second))
 			{
-				commands.push(actionBindings_[pair.second]);
+				pushAction(pair.second, commands);
 			}
 		}
 	}
@@ -125,17 +97,9 @@ namespace GEX
 		return currentMissionStatus_;
 	}
 
-	void PlayerControl::initializeActions()
+	void PlayerControl::setRecorder(ReplayRecorder* recorder)
 	{
-		const float playerSpeed = 200.f;
-
-		actionBindings_[Action::MoveLeft].action = derivedAction<Player>(AircraftMover(-playerSpeed, 0.f));
-		actionBindings_[Action::MoveRight].action = derivedAction<Player>(AircraftMover(playerSpeed, 0.f));
-		actionBindings_[Action::MoveUp].action = derivedAction<Player>(AircraftMover(0.f, -playerSpeed));
-		actionBindings_[Action::MoveDown].action = derivedAction<Player>(AircraftMover(0.f, playerSpeed));
-
-		actionBindings_[Action::Fire].action = derivedAction<Player>(std::bind(&Player::fire, std::placeholders::_1));
-		//actionBindings_[Action::LaunchMissile].action = derivedAction<Player>(std::bind(&Player::launchMissile, std::placeholders::_1));
+		recorder_ = recorder;
 	}
 
 	bool PlayerControl::isRealTimeAction(Action action)
@@ -156,4 +120,32 @@ namespace GEX
 			return false;
 		}
 	}
+
+	void PlayerControl::setRecordPath(const std::string& path)
+	{
+		recordPath_ = path;
+	}
+
+	const std::string& PlayerControl::getRecordPath() const
+	{
+		return recordPath_;
+	}
+
+	void PlayerControl::setReplayPath(const std::string& path)
+	{
+		replayPath_ = path;
+	}
+
+	const std::string& PlayerControl::getReplayPath() const
+	{
+		return replayPath_;
+	}
+
+	void PlayerControl::pushAction(Action action, CommandQueue& commands)
+	{
+		commands.push(makeActionCommand(action));
+
+		if (recorder_)
+			recorder_->record(action);
+	}
 }
\ No newline at end of file
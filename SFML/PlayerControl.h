@@ -34,30 +34,21 @@
 
 #pragma once
 
-#include <SFML\Window\Keyboard.hpp>
-#include <SFML\Window\Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Event.hpp>
 
 #include <map>
+#include <string>
 
 #include "Command.h"
+#include "PlayerAction.h"
 
 
 namespace GEX
 { 
 	//	forward declaration
 	class CommandQueue;
-
-	enum class Action
-	{
-		MoveLeft,
-		MoveRight,
-		MoveUp,
-		MoveDown,
-		RR,
-		RL,
-		Fire,
-		LaunchMissile
-	};
+	class ReplayRecorder;
 
 	enum class MissionStatus
 	{
@@ -76,14 +67,26 @@ namespace GEX
 
 		void			setCurrentMissionStatus(MissionStatus status);
 		MissionStatus	getCurrentMissionStatus() const;
+
+			//every action pushed from now on is also logged to the recorder, nullptr stops logging
+		void			setRecorder(ReplayRecorder* recorder);
+
+			//games started from now on record to, or play back from, these files; empty turns it off
+		void			setRecordPath(const std::string& path);
+		const std::string&	getRecordPath() const;
+		void			setReplayPath(const std::string& path);
+		const std::string&	getReplayPath() const;
 		
 	private:
-		void			initializeActions();
 		static bool		isRealTimeAction(Action action);
 
+		void			pushAction(Action action, CommandQueue& commands);
+
 	private:
 		std::map<sf::Keyboard::Key, Action> keyBindings_;
-		std::map<Action, Command>			actionBindings_;
 		MissionStatus						currentMissionStatus_;
+		ReplayRecorder*						recorder_;
+		std::string							recordPath_;
+		std::string							replayPath_;
 	};
 }
@@ -0,0 +1,108 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Profiler Class
+* Scoped timers recorded into a ring buffer and exported as Chrome trace events
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "Profiler.h"
+
+#include <fstream>
+
+namespace GEX
+{
+	Profiler* Profiler::instance_ = nullptr;
+
+	const std::size_t Profiler::Capacity;
+
+	Profiler& Profiler::getInstance()
+	{
+		if (!instance_)
+			instance_ = new Profiler();
+
+		return *instance_;
+	}
+
+	Profiler::Profiler()
+	: origin_(Clock::now())
+	, events_(Capacity)
+	, next_(0)
+	, count_(0)
+	{
+	}
+
+	void Profiler::record(const char* name, Clock::time_point start, Clock::time_point end)
+	{
+		Event& event = events_[next_];
+		event.name = name;
+		event.start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin_).count();
+		event.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+		next_ = (next_ + 1) % Capacity;
+		if (count_ < Capacity)
+			++count_;
+	}
+
+	//Complete ("X") events, oldest first, timestamps in microseconds as the format expects
+	bool Profiler::writeChromeTrace(const std::string& path) const
+	{
+		std::ofstream out(path);
+		if (!out)
+			return false;
+
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		std::size_t first = (next_ + Capacity - count_) % Capacity;
+		for (std::size_t i = 0; i < count_; ++i)
+		{
+			const Event& event = events_[(first + i) % Capacity];
+
+			out << (i == 0 ? "\n" : ",\n")
+				<< "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+				<< ",\"ts\":" << event.start / 1000 << "." << event.start % 1000 / 100
+				<< ",\"dur\":" << event.duration / 1000 << "." << event.duration % 1000 / 100 << "}";
+		}
+
+		out << "\n]}\n";
+		return static_cast<bool>(out);
+	}
+
+	void Profiler::clear()
+	{
+		next_ = 0;
+		count_ = 0;
+	}
+
+	std::size_t Profiler::getEventCount() const
+	{
+		return count_;
+	}
+}
@@ -0,0 +1,121 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Profiler Class
+* Scoped timers recorded into a ring buffer and exported as Chrome trace events
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+// Build with GEX_PROFILING=1 to record; otherwise the macros below expand to nothing
+#ifndef GEX_PROFILING
+#define GEX_PROFILING 0
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GEX
+{
+	// Keeps the last Capacity completed scopes. Recording happens on the main thread only.
+	// The trace opens in chrome://tracing or ui.perfetto.dev
+	class Profiler
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		static const std::size_t	Capacity = 1 << 16;
+
+	public:
+		static Profiler&			getInstance();
+
+		void						record(const char* name, Clock::time_point start, Clock::time_point end);
+
+		bool						writeChromeTrace(const std::string& path) const;
+		void						clear();
+
+		std::size_t					getEventCount() const;
+
+	private:
+									Profiler();
+									Profiler(const Profiler&) = delete;
+		Profiler&					operator=(const Profiler&) = delete;
+
+	private:
+		struct Event
+		{
+			const char*				name;			// must be a string literal, only the pointer is kept
+			std::int64_t			start;			// nanoseconds since the profiler was created
+			std::int64_t			duration;
+		};
+
+	private:
+		static Profiler*			instance_;
+
+		Clock::time_point			origin_;
+		std::vector<Event>			events_;
+		std::size_t					next_;
+		std::size_t					count_;
+	};
+
+	// Times the enclosing scope
+	class ScopedTimer
+	{
+	public:
+		explicit					ScopedTimer(const char* name)
+		: name_(name)
+		, start_(Profiler::Clock::now())
+		{
+		}
+
+									~ScopedTimer()
+		{
+			Profiler::getInstance().record(name_, start_, Profiler::Clock::now());
+		}
+
+									ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer&				operator=(const ScopedTimer&) = delete;
+
+	private:
+		const char*					name_;
+		Profiler::Clock::time_point	start_;
+	};
+}
+
+#if GEX_PROFILING
+#define GEX_PROFILE_CONCAT_(a, b) a##b
+#define GEX_PROFILE_CONCAT(a, b) GEX_PROFILE_CONCAT_(a, b)
+#define GEX_PROFILE_SCOPE(name) GEX::ScopedTimer GEX_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define GEX_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -37,6 +37,8 @@
 #include "Category.h"
 #include "DataTables.h"
 #include "EmitterNode.h"
+#include "NodePool.h"
+#include "SpriteBatch.h"
 
 namespace GEX
 { 
@@ -48,7 +50,9 @@ namespace GEX
 	GEX::Projectile::Projectile(Type type, const TextureManager & textures)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, sprite_(textures.createSprite(TABLE.at(type).texture, TABLE.at(type).textureRect))
+		, targetDirection_()
+		, displacement_()
 	{
 		centerOrigin(sprite_);
 
@@ -64,6 +68,16 @@ namespace GEX
 		}
 	}
 
+	void* GEX::Projectile::operator new(std::size_t size)
+	{
+		return NodePool<Projectile>::getInstance().allocate(size);
+	}
+
+	void GEX::Projectile::operator delete(void* block, std::size_t size)
+	{
+		NodePool<Projectile>::getInstance().deallocate(block, size);
+	}
+
 	unsigned int GEX::Projectile::getCategory() const
 	{
 		if (type_ == Type::EnemyBullet)
@@ -93,7 +107,23 @@ namespace GEX
 		targetDirection_ = unitVector(position - getWorldPosition());
 	}
 
-	sf::FloatRect Projectile::getBoundingBox() const
+	//How far the projectile travelled during its last update
+	sf::Vector2f Projectile::getDisplacement() const
+	{
+		return displacement_;
+	}
+
+	//Sweeps the projectile from where it started the tick to where it is now
+	bool Projectile::sweep(const sf::FloatRect& target, float& time) const
+	{
+		sf::FloatRect start = getBoundingBox();
+		start.left -= displacement_.x;
+		start.top -= displacement_.y;
+
+		return sweptIntersects(start, displacement_, target, time);
+	}
+
+	sf::FloatRect Projectile::computeBoundingBox() const
 	{
 		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
 	}
@@ -113,11 +143,15 @@ namespace GEX
 			setRotation(toDegree(angle) + 90.f);
 		}
 
+		sf::Vector2f start = getWorldPosition();
+
 		Entity::updateCurrent(dt, commands);
+
+		displacement_ = getWorldPosition() - start;
 	}
 
-	void GEX::Projectile::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void GEX::Projectile::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
 	{
-		target.draw(sprite_, states);
+		batch.draw(sprite_, states);
 	}
 }
\ No newline at end of file
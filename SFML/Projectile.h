@@ -53,6 +53,9 @@ namespace GEX
 	public:
 							Projectile(Type type, const TextureManager& textures);
 
+		static void*		operator new(std::size_t size);
+		static void			operator delete(void* block, std::size_t size);
+
 		unsigned int		getCategory() const override;
 		//sf::FloatRect		getBoundingRect() const override;
 
@@ -62,17 +65,20 @@ namespace GEX
 		bool				isGuided() const;
 		void				guidedTowards(sf::Vector2f position);
 
-		sf::FloatRect		getBoundingBox() const override;
+		sf::Vector2f		getDisplacement() const;
+		bool				sweep(const sf::FloatRect& target, float& time) const;
 
 	protected:
+		sf::FloatRect		computeBoundingBox() const override;
 		void				updateCurrent(sf::Time dt, GEX::CommandQueue& commands) override;
 
 	private:
-		void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void				drawCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
 	private:
 		Type				type_;
 		sf::Sprite			sprite_;
 		sf::Vector2f		targetDirection_;
+		sf::Vector2f		displacement_;
 	};
 }
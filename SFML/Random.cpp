@@ -0,0 +1,200 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Random Class
+* Small seedable xoshiro128** generator, one stream per World and jump ahead substreams for threads
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "Random.h"
+
+#include <cassert>
+
+namespace GEX
+{
+	namespace
+	{
+		std::uint32_t rotateLeft(std::uint32_t value, int bits)
+		{
+			return (value << bits) | (value >> (32 - bits));
+		}
+
+		//Spreads a seed over the whole state, so nearby seeds still give unrelated streams
+		std::uint64_t splitMix(std::uint64_t& state)
+		{
+			std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+			return z ^ (z >> 31);
+		}
+
+		//Lemire's multiply and reject, one multiplication in the common case
+		std::uint32_t bounded(Random& random, std::uint32_t bound)
+		{
+			std::uint64_t product = static_cast<std::uint64_t>(random.next()) * bound;
+			std::uint32_t low = static_cast<std::uint32_t>(product);
+
+			if (low < bound)
+			{
+				std::uint32_t threshold = (0u - bound) % bound;
+				while (low < threshold)
+				{
+					product = static_cast<std::uint64_t>(random.next()) * bound;
+					low = static_cast<std::uint32_t>(product);
+				}
+			}
+
+			return static_cast<std::uint32_t>(product >> 32);
+		}
+
+		float toUnitFloat(std::uint32_t value)
+		{
+			//top 24 bits fill a float mantissa exactly
+			return (value >> 8) * (1.f / 16777216.f);
+		}
+	}
+
+	Random::Random(std::uint64_t seed)
+	{
+		this->seed(seed);
+	}
+
+	void Random::seed(std::uint64_t seed)
+	{
+		std::uint64_t low = splitMix(seed);
+		std::uint64_t high = splitMix(seed);
+
+		state_[0] = static_cast<std::uint32_t>(low);
+		state_[1] = static_cast<std::uint32_t>(low >> 32);
+		state_[2] = static_cast<std::uint32_t>(high);
+		state_[3] = static_cast<std::uint32_t>(high >> 32);
+
+		for (int i = 0; i < 4; ++i)
+			seedState_[i] = state_[i];
+	}
+
+	std::uint32_t Random::next()
+	{
+		const std::uint32_t result = rotateLeft(state_[1] * 5, 7) * 9;
+		const std::uint32_t t = state_[1] << 9;
+
+		state_[2] ^= state_[0];
+		state_[3] ^= state_[1];
+		state_[1] ^= state_[2];
+		state_[0] ^= state_[3];
+		state_[2] ^= t;
+		state_[3] = rotateLeft(state_[3], 11);
+
+		return result;
+	}
+
+	std::uint32_t Random::operator()()
+	{
+		return next();
+	}
+
+	int Random::nextInt(int exclusiveMax)
+	{
+		assert(exclusiveMax > 0);
+		return static_cast<int>(bounded(*this, static_cast<std::uint32_t>(exclusiveMax)));
+	}
+
+	float Random::nextFloat()
+	{
+		return toUnitFloat(next());
+	}
+
+	float Random::nextFloat(float min, float max)
+	{
+		return min + (max - min) * nextFloat();
+	}
+
+	void Random::fill(std::uint32_t* values, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = next();
+	}
+
+	void Random::fillInts(int* values, std::size_t count, int exclusiveMax)
+	{
+		assert(exclusiveMax > 0);
+
+		const std::uint32_t bound = static_cast<std::uint32_t>(exclusiveMax);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = static_cast<int>(bounded(*this, bound));
+	}
+
+	void Random::fillFloats(float* values, std::size_t count, float min, float max)
+	{
+		const float range = max - min;
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = min + range * toUnitFloat(next());
+	}
+
+	Random Random::substream(unsigned int index) const
+	{
+		Random stream(*this);
+		for (int i = 0; i < 4; ++i)
+			stream.state_[i] = seedState_[i];
+
+		for (unsigned int i = 0; i <= index; ++i)
+			stream.jump();
+
+		//a substream's own substreams branch from where it starts
+		for (int i = 0; i < 4; ++i)
+			stream.seedState_[i] = stream.state_[i];
+
+		return stream;
+	}
+
+	void Random::jump()
+	{
+		//Equivalent to 2^64 calls to next()
+		static const std::uint32_t JUMP[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+		std::uint32_t jumped[4] = { 0, 0, 0, 0 };
+
+		for (std::uint32_t word : JUMP)
+		{
+			for (int bit = 0; bit < 32; ++bit)
+			{
+				if (word & (1u << bit))
+				{
+					for (int i = 0; i < 4; ++i)
+						jumped[i] ^= state_[i];
+				}
+				next();
+			}
+		}
+
+		for (int i = 0; i < 4; ++i)
+			state_[i] = jumped[i];
+	}
+}
@@ -0,0 +1,85 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Random Class
+* Small seedable xoshiro128** generator, one stream per World and jump ahead substreams for threads
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace GEX
+{
+	// 32 bytes of state, live and as seeded, and a handful of instructions per draw. The same seed
+	// gives the same sequence on every platform, which is what replays and benchmark scenarios rely on.
+	// Satisfies UniformRandomBitGenerator, so it also drives std::shuffle and <random> distributions
+	class Random
+	{
+	public:
+		using result_type = std::uint32_t;
+
+	public:
+		explicit				Random(std::uint64_t seed = 0);
+
+		void					seed(std::uint64_t seed);
+
+		std::uint32_t			next();
+		std::uint32_t			operator()();
+
+			//uniform in [0, exclusiveMax), without modulo bias
+		int						nextInt(int exclusiveMax);
+			//uniform in [0, 1)
+		float					nextFloat();
+		float					nextFloat(float min, float max);
+
+			//bulk draws, a tight loop over the state for particle bursts and spawn batches
+		void					fill(std::uint32_t* values, std::size_t count);
+		void					fillInts(int* values, std::size_t count, int exclusiveMax);
+		void					fillFloats(float* values, std::size_t count, float min, float max);
+
+			//an independent stream 2^64 draws past the seed per index, one per worker thread;
+			//it depends only on the seed and index, not on how far the parent has drawn
+		Random					substream(unsigned int index) const;
+
+		static constexpr result_type	min() { return 0; }
+		static constexpr result_type	max() { return std::numeric_limits<result_type>::max(); }
+
+	private:
+		void					jump();
+
+	private:
+		std::uint32_t			state_[4];
+		std::uint32_t			seedState_[4];		// state_ as seeded, substreams start from here
+	};
+}
@@ -0,0 +1,381 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* ReplayRecorder and ReplayPlayer Classes
+* Per tick player actions in a compact binary file, with keyframe checksums for seeking and desync checks
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "Replay.h"
+#include "CommandQueue.h"
+#include "World.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+
+namespace GEX
+{
+	namespace
+	{
+		const char			MAGIC[4] = { 'B', 'X', 'R', 'P' };
+		const std::uint8_t	VERSION = 1;
+
+		enum Record : std::uint8_t
+		{
+			TickActions = 1,
+			KeyframeMarker = 2,
+			End = 3
+		};
+
+		void writeVarint(std::ostream& out, std::uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				out.put(static_cast<char>((value & 0x7f) | 0x80));
+				value >>= 7;
+			}
+			out.put(static_cast<char>(value));
+		}
+
+		void writeFixed(std::ostream& out, std::uint32_t value)
+		{
+			for (int i = 0; i < 4; ++i)
+				out.put(static_cast<char>((value >> (i * 8)) & 0xff));
+		}
+
+		class Reader
+		{
+		public:
+			explicit		Reader(const std::vector<char>& data)
+			: data_(data)
+			, position_(0)
+			{
+			}
+
+			bool			isAtEnd() const
+			{
+				return position_ >= data_.size();
+			}
+
+			std::uint8_t	readByte()
+			{
+				if (isAtEnd())
+					throw std::runtime_error("Replay file is truncated");
+
+				return static_cast<std::uint8_t>(data_[position_++]);
+			}
+
+			std::uint32_t	readFixed()
+			{
+				std::uint32_t value = 0;
+				for (int i = 0; i < 4; ++i)
+					value |= static_cast<std::uint32_t>(readByte()) << (i * 8);
+
+				return value;
+			}
+
+			std::uint64_t	readVarint()
+			{
+				std::uint64_t value = 0;
+				for (int shift = 0; shift < 64; shift += 7)
+				{
+					std::uint8_t byte = readByte();
+					value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+
+					if (!(byte & 0x80))
+						return value;
+				}
+
+				throw std::runtime_error("Replay file has a malformed number");
+			}
+
+		private:
+			const std::vector<char>&	data_;
+			std::size_t		position_;
+		};
+	}
+
+	const std::size_t ReplayRecorder::DefaultKeyframeInterval;
+
+	ReplayRecorder::ReplayRecorder(const std::string& path, unsigned int seed, std::size_t keyframeInterval)
+	: out_(path, std::ios::binary)
+	, seed_(seed)
+	, keyframeInterval_(keyframeInterval)
+	, pending_()
+	, pendingChecksum_(0)
+	, hasPendingKeyframe_(false)
+	, tick_(0)
+	, lastRecordTick_(0)
+	, timePerTick_(sf::Time::Zero)
+	{
+		assert(keyframeInterval_ > 0);
+
+		if (!out_)
+			throw std::runtime_error("Replay could not be written to " + path);
+	}
+
+	ReplayRecorder::~ReplayRecorder()
+	{
+		if (timePerTick_ == sf::Time::Zero)
+			writeHeader(sf::Time::Zero);
+
+		out_.put(static_cast<char>(Record::End));
+		writeVarint(out_, tick_);
+	}
+
+	void ReplayRecorder::record(Action action)
+	{
+		pending_.push_back(action);
+	}
+
+	bool ReplayRecorder::isKeyframeDue() const
+	{
+		return tick_ % keyframeInterval_ == 0;
+	}
+
+	void ReplayRecorder::setKeyframe(std::uint32_t checksum)
+	{
+		pendingChecksum_ = checksum;
+		hasPendingKeyframe_ = true;
+	}
+
+	void ReplayRecorder::endTick(sf::Time timePerTick)
+	{
+		//The tick length is only known once the first tick runs
+		if (timePerTick_ == sf::Time::Zero)
+			writeHeader(timePerTick);
+
+		assert(timePerTick == timePerTick_);
+
+		if (hasPendingKeyframe_)
+		{
+			out_.put(static_cast<char>(Record::KeyframeMarker));
+			writeVarint(out_, tick_);
+			writeFixed(out_, pendingChecksum_);
+			hasPendingKeyframe_ = false;
+		}
+
+		if (!pending_.empty())
+		{
+			out_.put(static_cast<char>(Record::TickActions));
+			writeVarint(out_, tick_ - lastRecordTick_);
+			writeVarint(out_, pending_.size());
+
+			for (Action action : pending_)
+				out_.put(static_cast<char>(action));
+
+			lastRecordTick_ = tick_;
+			pending_.clear();
+		}
+
+		++tick_;
+	}
+
+	std::size_t ReplayRecorder::getTick() const
+	{
+		return tick_;
+	}
+
+	void ReplayRecorder::writeHeader(sf::Time timePerTick)
+	{
+		timePerTick_ = timePerTick;
+
+		out_.write(MAGIC, sizeof(MAGIC));
+		out_.put(static_cast<char>(VERSION));
+		writeFixed(out_, seed_);
+		writeFixed(out_, static_cast<std::uint32_t>(timePerTick.asMicroseconds()));
+	}
+
+	ReplayPlayer::ReplayPlayer(const std::string& path)
+	: seed_(0)
+	, timePerTick_(sf::Time::Zero)
+	, tickCount_(0)
+	, actions_()
+	, keyframes_()
+	, tick_(0)
+	, nextAction_(0)
+	, nextKeyframe_(0)
+	{
+		std::ifstream in(path, std::ios::binary);
+		if (!in)
+			throw std::runtime_error("Replay could not be opened: " + path);
+
+		std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		Reader reader(data);
+
+		for (char expected : MAGIC)
+		{
+			if (reader.readByte() != static_cast<std::uint8_t>(expected))
+				throw std::runtime_error("Not a replay file: " + path);
+		}
+
+		if (reader.readByte() != VERSION)
+			throw std::runtime_error("Unsupported replay version: " + path);
+
+		seed_ = reader.readFixed();
+		timePerTick_ = sf::microseconds(reader.readFixed());
+
+		std::size_t lastRecordTick = 0;
+		bool ended = false;
+
+		//A recording cut short by a crash has no end record, it still plays up to its last action
+		while (!reader.isAtEnd() && !ended)
+		{
+			switch (reader.readByte())
+			{
+				case Record::TickActions:
+				{
+					lastRecordTick += static_cast<std::size_t>(reader.readVarint());
+					std::size_t count = static_cast<std::size_t>(reader.readVarint());
+
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						std::uint8_t action = reader.readByte();
+						if (action >= static_cast<std::uint8_t>(Action::ActionCount))
+							throw std::runtime_error("Replay holds an unknown action: " + path);
+
+						actions_.emplace_back(lastRecordTick, static_cast<Action>(action));
+					}
+
+					tickCount_ = std::max(tickCount_, lastRecordTick + 1);
+					break;
+				}
+				case Record::KeyframeMarker:
+				{
+					std::size_t tick = static_cast<std::size_t>(reader.readVarint());
+					std::uint32_t checksum = reader.readFixed();
+					keyframes_.push_back(Keyframe{ tick, checksum, actions_.size() });
+					break;
+				}
+				case Record::End:
+					tickCount_ = static_cast<std::size_t>(reader.readVarint());
+					ended = true;
+					break;
+				default:
+					throw std::runtime_error("Replay file is corrupt: " + path);
+			}
+		}
+	}
+
+	unsigned int ReplayPlayer::getSeed() const
+	{
+		return seed_;
+	}
+
+	sf::Time ReplayPlayer::getTimePerTick() const
+	{
+		return timePerTick_;
+	}
+
+	std::size_t ReplayPlayer::getTickCount() const
+	{
+		return tickCount_;
+	}
+
+	std::size_t ReplayPlayer::getTick() const
+	{
+		return tick_;
+	}
+
+	bool ReplayPlayer::isFinished() const
+	{
+		return tick_ >= tickCount_;
+	}
+
+	bool ReplayPlayer::hasKeyframe() const
+	{
+		return nextKeyframe_ < keyframes_.size() && keyframes_[nextKeyframe_].tick == tick_;
+	}
+
+	std::uint32_t ReplayPlayer::getKeyframeChecksum() const
+	{
+		assert(hasKeyframe());
+		return keyframes_[nextKeyframe_].checksum;
+	}
+
+	void ReplayPlayer::feed(CommandQueue& commands)
+	{
+		for (; nextAction_ < actions_.size() && actions_[nextAction_].first == tick_; ++nextAction_)
+			commands.push(makeActionCommand(actions_[nextAction_].second));
+
+		if (hasKeyframe())
+			++nextKeyframe_;
+
+		++tick_;
+	}
+
+	//Keyframes only hold a checksum, so the world is rebuilt by simulation: up to the last keyframe at or
+	//before tick, where the action offset and checksum are checked, then on to tick itself
+	std::size_t ReplayPlayer::seek(World& world, std::size_t tick)
+	{
+		rewind();
+
+		auto after = std::upper_bound(keyframes_.begin(), keyframes_.end(), tick, [](std::size_t value, const Keyframe& keyframe)
+		{
+			return value < keyframe.tick;
+		});
+
+		std::size_t desyncs = 0;
+
+		if (after != keyframes_.begin())
+		{
+			const Keyframe& anchor = *std::prev(after);
+			desyncs += playTo(world, anchor.tick);
+			assert(nextAction_ == anchor.firstAction);
+		}
+
+		return desyncs + playTo(world, tick);
+	}
+
+	void ReplayPlayer::rewind()
+	{
+		tick_ = 0;
+		nextAction_ = 0;
+		nextKeyframe_ = 0;
+	}
+
+	std::size_t ReplayPlayer::playTo(World& world, std::size_t tick)
+	{
+		std::size_t desyncs = 0;
+
+		while (tick_ < tick && !isFinished())
+		{
+			if (hasKeyframe() && getKeyframeChecksum() != world.computeChecksum())
+				++desyncs;
+
+			feed(world.getCommandQueue());
+			world.update(timePerTick_, world.getCommandQueue());
+		}
+
+		return desyncs;
+	}
+}
@@ -0,0 +1,141 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* ReplayRecorder and ReplayPlayer Classes
+* Per tick player actions in a compact binary file, with keyframe checksums for seeking and desync checks
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include "PlayerAction.h"
+
+#include <SFML/System/Time.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace GEX
+{
+	// forward declaration
+	class CommandQueue;
+	class World;
+
+	// Replay files hold a header (seed and tick length) followed by records: the actions of
+	// every tick that had any, a keyframe checksum every keyframe interval ticks, and the tick count.
+	// Ticks are delta encoded as variable length integers, so an idle tick costs nothing
+	class ReplayRecorder
+	{
+	public:
+		static const std::size_t	DefaultKeyframeInterval = 300;
+
+	public:
+									ReplayRecorder(const std::string& path, unsigned int seed,
+												   std::size_t keyframeInterval = DefaultKeyframeInterval);
+									~ReplayRecorder();
+
+		void						record(Action action);
+
+			//the checksum of the world as the current tick starts, due every keyframe interval
+		bool						isKeyframeDue() const;
+		void						setKeyframe(std::uint32_t checksum);
+
+			//call before the world consumes this tick's commands
+		void						endTick(sf::Time timePerTick);
+
+		std::size_t					getTick() const;
+
+	private:
+		void						writeHeader(sf::Time timePerTick);
+
+	private:
+		std::ofstream				out_;
+		unsigned int				seed_;
+		std::size_t					keyframeInterval_;
+		std::vector<Action>			pending_;
+		std::uint32_t				pendingChecksum_;
+		bool						hasPendingKeyframe_;
+		std::size_t					tick_;
+		std::size_t					lastRecordTick_;
+		sf::Time					timePerTick_;
+	};
+
+	class ReplayPlayer
+	{
+	public:
+			//throws std::runtime_error when the file is missing or malformed
+		explicit					ReplayPlayer(const std::string& path);
+
+		unsigned int				getSeed() const;
+		sf::Time					getTimePerTick() const;
+		std::size_t					getTickCount() const;
+
+		std::size_t					getTick() const;
+		bool						isFinished() const;
+
+			//set when a checksum was recorded for the current tick, compare it before feeding
+		bool						hasKeyframe() const;
+		std::uint32_t				getKeyframeChecksum() const;
+
+			//pushes the current tick's actions and moves to the next tick
+		void						feed(CommandQueue& commands);
+
+			//plays the replay from its first tick into world, without drawing, until it reaches tick.
+			//world has to be freshly built with getSeed(). Returns how many keyframes on the way did not match
+		std::size_t					seek(World& world, std::size_t tick);
+
+	private:
+		void						rewind();
+		std::size_t					playTo(World& world, std::size_t tick);
+
+	private:
+		struct Keyframe
+		{
+			std::size_t				tick;
+			std::uint32_t			checksum;
+			std::size_t				firstAction;	// offset into actions_ of the first action at or after tick
+		};
+
+	private:
+		unsigned int				seed_;
+		sf::Time					timePerTick_;
+		std::size_t					tickCount_;
+
+		std::vector<std::pair<std::size_t, Action>>	actions_;
+		std::vector<Keyframe>		keyframes_;
+
+		std::size_t					tick_;
+		std::size_t					nextAction_;
+		std::size_t					nextKeyframe_;
+	};
+}
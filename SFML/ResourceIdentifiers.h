@@ -67,6 +67,24 @@ namespace GEX
 		PlayerDeath
 	};
 
+	enum class AnimationID
+	{
+		ZombieWalkUp,
+		ZombieWalkLeft,
+		ZombieWalkDown,
+		ZombieWalkRight,
+		ZombieDeath,
+		PlayerWalkUp,
+		PlayerWalkLeft,
+		PlayerWalkDown,
+		PlayerWalkRight,
+		PlayerIdleUp,
+		PlayerIdleLeft,
+		PlayerIdleDown,
+		PlayerIdleRight,
+		PlayerDeath
+	};
+
 	enum class MusicID
 	{
 		MenuTheme,
@@ -42,19 +42,74 @@
 #include "Category.h"
 #include "Command.h"
 #include "Utility.h"
+#include "SpatialHashGrid.h"
+#include "CategoryRegistry.h"
+#include "SpriteBatch.h"
 
 namespace GEX
 { 
+	namespace
+	{
+		// Collision boxes are trimmed versions of the sprites, so leave some slack before culling
+		const float CULL_MARGIN = 32.f;
+
+		bool isEmpty(const sf::FloatRect& rect)
+		{
+			return rect.width <= 0.f || rect.height <= 0.f;
+		}
+
+		sf::FloatRect unite(const sf::FloatRect& lhs, const sf::FloatRect& rhs)
+		{
+			if (isEmpty(lhs))
+				return rhs;
+
+			if (isEmpty(rhs))
+				return lhs;
+
+			float left = std::min(lhs.left, rhs.left);
+			float top = std::min(lhs.top, rhs.top);
+			float right = std::max(lhs.left + lhs.width, rhs.left + rhs.width);
+			float bottom = std::max(lhs.top + lhs.height, rhs.top + rhs.height);
+
+			return sf::FloatRect(left, top, right - left, bottom - top);
+		}
+	}
+
 	SceneNode::SceneNode(Category::Type category)
 		: children_()
 		, parent_(nullptr)
 		, category_(category)
+		, categoryRegistry_(nullptr)
+		, entityRegistry_(nullptr)
+		, handle_()
+		, worldTransform_()
+		, boundingBox_()
+		, drawBounds_()
+		, subtreeBounds_()
+		, isTransformDirty_(true)
+		, isBoundingBoxDirty_(true)
+		, isSubtreeBoundsDirty_(true)
+		, previousPosition_()
+		, hasPreviousPosition_(false)
 	{}
 
+	SceneNode::~SceneNode()
+	{
+		// Any handle still pointing at this node goes stale
+		if (entityRegistry_)
+			entityRegistry_->release(handle_);
+	}
+
 	void SceneNode::attachChild(Ptr child)
 	{
 		child->parent_ = this;
+		child->markTransformDirty();
+
+		if (categoryRegistry_ || entityRegistry_)
+			child->setRegistries(categoryRegistry_, entityRegistry_);
+
 		children_.push_back(std::move(child));
+		invalidateSubtreeBounds();
 	}
 
 	SceneNode::Ptr SceneNode::detachChild(const SceneNode& node)
@@ -69,32 +124,185 @@ namespace GEX
 		assert(found != children_.end());
 
 		Ptr result = std::move(*found);
+		result->parent_ = nullptr;
+		result->markTransformDirty();
 		children_.erase(found);
+		invalidateSubtreeBounds();
+
+		if (categoryRegistry_ || entityRegistry_)
+		{
+			std::vector<SceneNode*> detached;
+			result->collectSubtree(detached);
+
+			if (categoryRegistry_)
+				categoryRegistry_->remove(detached);
+
+			if (entityRegistry_)
+			{
+				for (SceneNode* node : detached)
+					entityRegistry_->release(node->handle_);
+			}
+
+			result->setRegistries(nullptr, nullptr);
+		}
 
 		return result;
 	}
 
+	void SceneNode::setPosition(float x, float y)
+	{
+		sf::Transformable::setPosition(x, y);
+		markTransformDirty();
+	}
+
+	void SceneNode::setPosition(const sf::Vector2f& position)
+	{
+		sf::Transformable::setPosition(position);
+		markTransformDirty();
+	}
+
+	void SceneNode::setRotation(float angle)
+	{
+		sf::Transformable::setRotation(angle);
+		markTransformDirty();
+	}
+
+	void SceneNode::setScale(float factorX, float factorY)
+	{
+		sf::Transformable::setScale(factorX, factorY);
+		markTransformDirty();
+	}
+
+	void SceneNode::setScale(const sf::Vector2f& factors)
+	{
+		sf::Transformable::setScale(factors);
+		markTransformDirty();
+	}
+
+	void SceneNode::setOrigin(float x, float y)
+	{
+		sf::Transformable::setOrigin(x, y);
+		markTransformDirty();
+	}
+
+	void SceneNode::setOrigin(const sf::Vector2f& origin)
+	{
+		sf::Transformable::setOrigin(origin);
+		markTransformDirty();
+	}
+
+	void SceneNode::move(float offsetX, float offsetY)
+	{
+		// Resting entities move by zero every tick, don't throw their caches away
+		if (offsetX == 0.f && offsetY == 0.f)
+			return;
+
+		sf::Transformable::move(offsetX, offsetY);
+		markTransformDirty();
+	}
+
+	void SceneNode::move(const sf::Vector2f& offset)
+	{
+		move(offset.x, offset.y);
+	}
+
+	void SceneNode::rotate(float angle)
+	{
+		sf::Transformable::rotate(angle);
+		markTransformDirty();
+	}
+
+	void SceneNode::scale(float factorX, float factorY)
+	{
+		sf::Transformable::scale(factorX, factorY);
+		markTransformDirty();
+	}
+
+	void SceneNode::scale(const sf::Vector2f& factor)
+	{
+		sf::Transformable::scale(factor);
+		markTransformDirty();
+	}
+
+	void SceneNode::storePreviousPosition()
+	{
+		previousPosition_ = getPosition();
+		hasPreviousPosition_ = true;
+
+		for (Ptr& child : children_)
+			child->storePreviousPosition();
+	}
+
 	sf::Vector2f SceneNode::getWorldPosition() const
 	{
 		return getWorldTransform() * sf::Vector2f();
 	}
 
-	sf::Transform SceneNode::getWorldTransform() const
+	const sf::Transform& SceneNode::getWorldTransform() const
+	{
+		if (isTransformDirty_)
+		{
+			if (parent_)
+				worldTransform_ = parent_->getWorldTransform() * getTransform();
+			else
+				worldTransform_ = getTransform();
+
+			isTransformDirty_ = false;
+		}
+
+		return worldTransform_;
+	}
+
+	const sf::FloatRect& SceneNode::getBoundingBox() const
 	{
-		sf::Transform transform = sf::Transform::Identity;
+		if (isBoundingBoxDirty_)
+		{
+			boundingBox_ = computeBoundingBox();
+			isBoundingBoxDirty_ = false;
+		}
+
+		return boundingBox_;
+	}
+
+	//Union of this node's draw bounds and every descendant's, rebuilt only after something below moved
+	const sf::FloatRect& SceneNode::getSubtreeBounds() const
+	{
+		if (isSubtreeBoundsDirty_)
+		{
+			drawBounds_ = computeDrawBounds();
+			subtreeBounds_ = drawBounds_;
+
+			for (const Ptr& child : children_)
+				subtreeBounds_ = unite(subtreeBounds_, child->getSubtreeBounds());
 
-		for (const SceneNode* node = this; node != nullptr; node = node->parent_)
-			transform = node->getTransform() * transform;
+			isSubtreeBoundsDirty_ = false;
+		}
 
-		return transform;
+		return subtreeBounds_;
 	}
 
-	sf::FloatRect SceneNode::getBoundingBox() const
+	sf::FloatRect SceneNode::computeBoundingBox() const
 	{
 		return sf::FloatRect();
 	}
 
-	void SceneNode::drawBoundingBox(sf::RenderTarget & target, sf::RenderStates states) const
+	void SceneNode::invalidateBoundingBox()
+	{
+		isBoundingBoxDirty_ = true;
+		invalidateSubtreeBounds();
+	}
+
+	sf::FloatRect SceneNode::computeDrawBounds() const
+	{
+		return getBoundingBox();
+	}
+
+	EntityRegistry* SceneNode::getEntityRegistry() const
+	{
+		return entityRegistry_;
+	}
+
+	void SceneNode::drawBoundingBox(SpriteBatch& batch, sf::RenderStates states) const
 	{
 		/*sf::FloatRect rect = getBoundingBox();
 
@@ -105,7 +313,7 @@ namespace GEX
 		box.setOutlineColor(sf::Color::Cyan);
 		box.setOutlineThickness(1.f);
 
-		target.draw(box);*/
+		batch.draw(box, states);*/
 	}
 
 	bool SceneNode::isDestroyed() const
@@ -120,8 +328,28 @@ namespace GEX
 
 	void SceneNode::removeWrecks()
 	{
+		if (categoryRegistry_)
+		{
+			// Unregister before remove_if, moving the survivors forward destroys the wrecks
+			std::vector<SceneNode*> wrecks;
+
+			for (Ptr& child : children_)
+			{
+				if (child->isMarkedForRemoval())
+					child->collectSubtree(wrecks);
+			}
+
+			if (!wrecks.empty())
+				categoryRegistry_->remove(wrecks);
+		}
+
 		auto wreckFieldBegin = std::remove_if(children_.begin(), children_.end(), std::mem_fn(&SceneNode::isMarkedForRemoval));
-		children_.erase(wreckFieldBegin, children_.end());
+
+		if (wreckFieldBegin != children_.end())
+		{
+			children_.erase(wreckFieldBegin, children_.end());
+			invalidateSubtreeBounds();
+		}
 
 		std::for_each(children_.begin(), children_.end(), std::mem_fn(&SceneNode::removeWrecks));
 	}
@@ -143,6 +371,14 @@ namespace GEX
 			c->checkNodeCollision(node, collisionPair);
 	}
 
+	void SceneNode::insertIntoGrid(SpatialHashGrid& grid)
+	{
+		grid.insert(*this);
+
+		for (Ptr& c : children_)
+			c->insertIntoGrid(grid);
+	}
+
 	void SceneNode::update(sf::Time dt, CommandQueue& commands)
 	{
 		updateCurrent(dt, commands);
@@ -164,6 +400,25 @@ namespace GEX
 		return category_;
 	}
 
+	void SceneNode::setRegistries(CategoryRegistry* categories, EntityRegistry* entities)
+	{
+		categoryRegistry_ = categories;
+		entityRegistry_ = entities;
+
+		if (categoryRegistry_)
+			categoryRegistry_->add(*this);
+
+		handle_ = entityRegistry_ ? entityRegistry_->create(*this) : EntityHandle();
+
+		for (Ptr& child : children_)
+			child->setRegistries(categories, entities);
+	}
+
+	EntityHandle SceneNode::getHandle() const
+	{
+		return handle_;
+	}
+
 	void SceneNode::updateCurrent(sf::Time dt, CommandQueue& commands)
 	{
 		//default to do nothing.
@@ -179,26 +434,89 @@ namespace GEX
 
 	void SceneNode::draw(sf::RenderTarget & target, sf::RenderStates states) const
 	{
-		states.transform *= getTransform();
+		SpriteBatch batch(target);
+
+		draw(batch, states);
+		batch.flush();
+	}
 
-		drawCurrent(target, states);
-		drawChildren(target, states);
+	void SceneNode::draw(SpriteBatch& batch, sf::RenderStates states, float interpolation) const
+	{
+		const sf::View& view = batch.getTarget().getView();
+
+		sf::FloatRect viewBounds(view.getCenter() - view.getSize() / 2.f, view.getSize());
+		viewBounds.left -= CULL_MARGIN;
+		viewBounds.top -= CULL_MARGIN;
+		viewBounds.width += 2.f * CULL_MARGIN;
+		viewBounds.height += 2.f * CULL_MARGIN;
 
-		drawBoundingBox(target, states);
+		drawSubtree(batch, states, viewBounds, interpolation);
 	}
 
-	void SceneNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void SceneNode::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
 	{
 		//default to do nothing.
 	}
 
-	void SceneNode::drawChildren(sf::RenderTarget & target, sf::RenderStates states) const
+	void SceneNode::drawSubtree(SpriteBatch& batch, sf::RenderStates states, const sf::FloatRect& viewBounds, float interpolation) const
+	{
+		//Nothing below this node reaches the view, skip the whole branch
+		const sf::FloatRect& bounds = getSubtreeBounds();
+		if (!isEmpty(bounds) && !bounds.intersects(viewBounds))
+			return;
+
+		//Pull the node back towards where it was last tick, nodes spawned this tick have nowhere to come from
+		if (hasPreviousPosition_ && interpolation < 1.f)
+			states.transform.translate((previousPosition_ - getPosition()) * (1.f - interpolation));
+
+		states.transform *= getTransform();
+
+		//The branch may only be visible through a child, own bounds were cached with the subtree's above
+		if (isEmpty(drawBounds_) || drawBounds_.intersects(viewBounds))
+			drawCurrent(batch, states);
+
+		drawChildren(batch, states, viewBounds, interpolation);
+
+		drawBoundingBox(batch, states);
+	}
+
+	void SceneNode::drawChildren(SpriteBatch& batch, sf::RenderStates states, const sf::FloatRect& viewBounds, float interpolation) const
 	{
 		for (const Ptr& child : children_)
 		{
-			child->draw(target, states);
+			child->drawSubtree(batch, states, viewBounds, interpolation);
 		}
 	}
+
+	void SceneNode::markTransformDirty()
+	{
+		isBoundingBoxDirty_ = true;
+		invalidateSubtreeBounds();
+
+		// A dirty node never has clean descendants, so the walk can stop here
+		if (isTransformDirty_)
+			return;
+
+		isTransformDirty_ = true;
+
+		for (Ptr& child : children_)
+			child->markTransformDirty();
+	}
+
+	void SceneNode::invalidateSubtreeBounds()
+	{
+		// A dirty node always has dirty ancestors, so the walk up can stop at the first one
+		for (SceneNode* node = this; node && !node->isSubtreeBoundsDirty_; node = node->parent_)
+			node->isSubtreeBoundsDirty_ = true;
+	}
+
+	void SceneNode::collectSubtree(std::vector<SceneNode*>& nodes)
+	{
+		nodes.push_back(this);
+
+		for (Ptr& child : children_)
+			child->collectSubtree(nodes);
+	}
 	
 	float distance(const SceneNode & lhs, const SceneNode & rhs)
 	{
@@ -34,9 +34,9 @@
 
 #pragma once
 
-#include <SFML\Graphics\Transformable.hpp>
-#include <SFML\Graphics\Drawable.hpp>
-#include <SFML\System\Time.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/System/Time.hpp>
 
 #include <vector>
 #include <memory>
@@ -45,6 +45,7 @@
 #include "Command.h"
 #include "Category.h"
 #include "CommandQueue.h"
+#include "EntityRegistry.h"
 
 // forward declarations
 struct Command;
@@ -52,6 +53,10 @@ class CommandQueue;
 
 namespace GEX
 { 
+	class SpatialHashGrid;
+	class CategoryRegistry;
+	class SpriteBatch;
+
 	class SceneNode : public sf::Transformable, public sf::Drawable
 	{	
 	public:
@@ -60,7 +65,7 @@ namespace GEX
 
 	public:
 								SceneNode(Category::Type category = Category::Type::None);
-		virtual					~SceneNode() = default;
+		virtual					~SceneNode();
 								SceneNode(const SceneNode&) = delete;
 								SceneNode& operator=(SceneNode&) = delete;
 
@@ -68,14 +73,37 @@ namespace GEX
 		Ptr						detachChild(const SceneNode& node);
 
 		void					update(sf::Time dt, CommandQueue& commands);
+		void					draw(SpriteBatch& batch, sf::RenderStates states = sf::RenderStates::Default, float interpolation = 1.f) const;
 		void					onCommand(const Command& command, sf::Time dt);
 		virtual unsigned int	getCategory() const;
 
+			//register this node and everything attached below it, children attached later follow automatically
+		void					setRegistries(CategoryRegistry* categories, EntityRegistry* entities);
+		EntityHandle			getHandle() const;
+
+		// Shadow the sf::Transformable setters so cached world data can be invalidated
+		void					setPosition(float x, float y);
+		void					setPosition(const sf::Vector2f& position);
+		void					setRotation(float angle);
+		void					setScale(float factorX, float factorY);
+		void					setScale(const sf::Vector2f& factors);
+		void					setOrigin(float x, float y);
+		void					setOrigin(const sf::Vector2f& origin);
+		void					move(float offsetX, float offsetY);
+		void					move(const sf::Vector2f& offset);
+		void					rotate(float angle);
+		void					scale(float factorX, float factorY);
+		void					scale(const sf::Vector2f& factor);
+
+			//snapshot taken at the start of a tick, drawing blends from it to the current position
+		void					storePreviousPosition();
+
 		sf::Vector2f			getWorldPosition() const;
-		sf::Transform			getWorldTransform() const;
+		const sf::Transform&	getWorldTransform() const;
 
-		virtual sf::FloatRect	getBoundingBox() const;
-		void					drawBoundingBox(sf::RenderTarget& target, sf::RenderStates states) const;
+		const sf::FloatRect&	getBoundingBox() const;
+		const sf::FloatRect&	getSubtreeBounds() const;
+		void					drawBoundingBox(SpriteBatch& batch, sf::RenderStates states) const;
 
 		virtual bool			isDestroyed() const;
 		virtual bool			isMarkedForRemoval() const;
@@ -84,23 +112,52 @@ namespace GEX
 
 		void					checkSceneCollision(SceneNode& node, std::set<Pair>& collisionPair);
 		void					checkNodeCollision(SceneNode& node, std::set<Pair>& collisionPair);
+		void					insertIntoGrid(SpatialHashGrid& grid);
 
 	protected:
 			//update the tree
 		virtual void			updateCurrent(sf::Time dt, CommandQueue& commands);
 		void					updateChildren(sf::Time dt, CommandQueue& commands);
+
+			//world space bounding box, cached by getBoundingBox until the node or an ancestor moves
+		virtual sf::FloatRect	computeBoundingBox() const;
+		void					invalidateBoundingBox();
+
+			//world space area this node draws into, defaults to the bounding box
+		virtual sf::FloatRect	computeDrawBounds() const;
+
+		EntityRegistry*			getEntityRegistry() const;
 			
 	private:
 			//draw the tree
 		void					draw(sf::RenderTarget& target, sf::RenderStates states) const override;
-		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
-		void					drawChildren(sf::RenderTarget& target, sf::RenderStates states) const;
+		virtual void			drawCurrent(SpriteBatch& batch, sf::RenderStates states) const;
+		void					drawSubtree(SpriteBatch& batch, sf::RenderStates states, const sf::FloatRect& viewBounds, float interpolation) const;
+		void					drawChildren(SpriteBatch& batch, sf::RenderStates states, const sf::FloatRect& viewBounds, float interpolation) const;
+
+		void					markTransformDirty();
+		void					invalidateSubtreeBounds();
+		void					collectSubtree(std::vector<SceneNode*>& nodes);
 		
 	private:
 		SceneNode *				parent_;
 		std::vector<Ptr>		children_;
 
 		Category::Type			category_;
+		CategoryRegistry*		categoryRegistry_;
+		EntityRegistry*			entityRegistry_;
+		EntityHandle			handle_;
+
+		mutable sf::Transform	worldTransform_;
+		mutable sf::FloatRect	boundingBox_;
+		mutable sf::FloatRect	drawBounds_;			// this node's own computeDrawBounds, refreshed with subtreeBounds_
+		mutable sf::FloatRect	subtreeBounds_;
+		mutable bool			isTransformDirty_;
+		mutable bool			isBoundingBoxDirty_;
+		mutable bool			isSubtreeBoundsDirty_;
+
+		sf::Vector2f			previousPosition_;
+		bool					hasPreviousPosition_;
 	};
 
 	float distance(const SceneNode& lhs, const SceneNode& rhs);
@@ -36,8 +36,8 @@
 #include "DataTables.h"
 #include "Utility.h"
 #include "SoundNode.h"
+#include "SpriteBatch.h"
 
-using namespace std::placeholders;
 
 namespace GEX
 { 
@@ -50,11 +50,11 @@ namespace GEX
 		: Entity(TABLE.at(type).hitpoints)
 		, type_(type)
 		, state_(Skeleton::State::Down)
-		, walkUp_(textures.get(TextureID::SkeletonWalkUp))
-		, walkLeft_(textures.get(TextureID::SkeletonWalkUp))
-		, walkDown_(textures.get(TextureID::SkeletonWalkDown))
-		, walkRight_(textures.get(TextureID::SkeletonWalkRight))
-		, sprite_(textures.get(TABLE.at(type).texture))
+		, walkUp_(textures.createSprite(TextureID::SkeletonWalkUp))
+		, walkLeft_(textures.createSprite(TextureID::SkeletonWalkUp))
+		, walkDown_(textures.createSprite(TextureID::SkeletonWalkDown))
+		, walkRight_(textures.createSprite(TextureID::SkeletonWalkRight))
+		, sprite_(textures.createSprite(TABLE.at(type).texture))
 		, animations_()
 		, travelDistance_(0.f)
 		, directionIndex_(0)
@@ -66,9 +66,9 @@ namespace GEX
 		setupAnimations();
 	}
 
-	void Skeleton::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void Skeleton::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
 	{
-		target.draw(sprite_, states);
+		batch.draw(sprite_, states);
 	}
 
 	unsigned int Skeleton::getCategory() const
@@ -76,7 +76,7 @@ namespace GEX
 		return Category::Skeleton;
 	}
 
-	sf::FloatRect Skeleton::getBoundingBox() const
+	sf::FloatRect Skeleton::computeBoundingBox() const
 	{
 		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
 	}
@@ -96,11 +96,12 @@ namespace GEX
 	{
 		Command playSoundCommand;
 		playSoundCommand.category = Category::SoundEffect;
-		playSoundCommand.action = derivedAction<SoundNode>(
-			std::bind(&SoundNode::playSound, _1, effect, getWorldPosition())
-			);
+		playSoundCommand.action = derivedAction<SoundNode>([effect, position = getWorldPosition()](SoundNode& node, sf::Time)
+		{
+			node.playSound(effect, position);
+		});
 
-		commands.push(playSoundCommand);
+		commands.push(std::move(playSoundCommand));
 	}
 
 	void Skeleton::updateCurrent(sf::Time dt, CommandQueue & commands)
@@ -60,11 +60,9 @@ namespace GEX
 	public:
 		Skeleton(Skeleton::SkeletonType type, const TextureManager& textures);
 
-		void					drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void					drawCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 		unsigned int			getCategory() const override;
 
-		sf::FloatRect			getBoundingBox() const override;
-
 		bool					isMarkedForRemoval() const override;
 
 		void					remove() override;
@@ -72,6 +70,7 @@ namespace GEX
 		void					playLocalSound(CommandQueue& commands, SoundEffectID effect);
 
 	protected:
+		sf::FloatRect			computeBoundingBox() const override;
 		void					updateCurrent(sf::Time dt, CommandQueue& commands) override;
 
 	private:
@@ -34,9 +34,23 @@
 
 #include <SFML/Graphics.hpp>
 #include "Application.h"
-int main()
+
+#include <string>
+
+int main(int argc, char* argv[])
 {
 	Application app;
 
+		//--record <file> saves the input of every game, --replay <file> plays one back
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+
+		if (option == "--record")
+			app.recordReplay(argv[i + 1]);
+		else if (option == "--replay")
+			app.playReplay(argv[i + 1]);
+	}
+
 	app.run();
 }
\ No newline at end of file
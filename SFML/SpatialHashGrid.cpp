@@ -0,0 +1,222 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpatialHashGrid Class
+* Uniform grid broad-phase used to find colliding SceneNodes
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "SpatialHashGrid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace GEX
+{
+	namespace
+	{
+		// Only half of the 3x3 neighbourhood is visited per cell so every neighbouring pair is tested once
+		const sf::Vector2i FORWARD_NEIGHBOURS[] =
+		{
+			sf::Vector2i( 1, 0),
+			sf::Vector2i(-1, 1),
+			sf::Vector2i( 0, 1),
+			sf::Vector2i( 1, 1)
+		};
+	}
+
+	SpatialHashGrid::SpatialHashGrid(float cellSize)
+		: cellSize_(cellSize)
+		, nodes_()
+		, boxes_()
+		, categories_()
+		, ignoredCategories_(0)
+		, cells_()
+		, occupiedCells_()
+		, oversized_()
+	{
+		assert(cellSize_ > 0.f);
+	}
+
+	void SpatialHashGrid::clear()
+	{
+		// Keep the cell buckets around so their storage is reused next tick
+		for (CellKey key : occupiedCells_)
+			cells_[key].entries.clear();
+
+		occupiedCells_.clear();
+		oversized_.clear();
+		nodes_.clear();
+		boxes_.clear();
+		categories_.clear();
+	}
+
+	void SpatialHashGrid::insert(SceneNode& node)
+	{
+		sf::FloatRect box = node.getBoundingBox();
+
+		if (box.width <= 0.f || box.height <= 0.f || node.isDestroyed())
+			return;
+
+		std::size_t index = nodes_.size();
+		nodes_.push_back(&node);
+		boxes_.push_back(box);
+		categories_.push_back(node.getCategory());
+
+		if (box.width > cellSize_ || box.height > cellSize_)
+		{
+			oversized_.push_back(index);
+			return;
+		}
+
+		sf::Vector2i coordinates = cellCoordinates(sf::Vector2f(box.left + box.width / 2.f, box.top + box.height / 2.f));
+		CellKey key = cellKey(coordinates.x, coordinates.y);
+
+		Cell& cell = cells_[key];
+		if (cell.entries.empty())
+			occupiedCells_.push_back(key);
+
+		cell.entries.push_back(index);
+	}
+
+	void SpatialHashGrid::findPairs(std::set<SceneNode::Pair>& collisionPairs) const
+	{
+		for (CellKey key : occupiedCells_)
+		{
+			const Cell& cell = cells_.at(key);
+			testCell(cell, collisionPairs);
+
+			const int x = static_cast<int>(key >> 32);
+			const int y = static_cast<int>(key & 0xFFFFFFFF);
+
+			for (const sf::Vector2i& offset : FORWARD_NEIGHBOURS)
+			{
+				auto found = cells_.find(cellKey(x + offset.x, y + offset.y));
+
+				if (found != cells_.end() && !found->second.entries.empty())
+					testCells(cell, found->second, collisionPairs);
+			}
+		}
+
+		// The pair set drops the duplicates produced when two oversized nodes meet
+		for (std::size_t i : oversized_)
+		{
+			for (std::size_t j = 0; j < nodes_.size(); ++j)
+				testPair(i, j, collisionPairs);
+		}
+	}
+
+	void SpatialHashGrid::query(const sf::FloatRect& area, std::vector<SceneNode*>& found) const
+	{
+		// Nodes are binned by their centre and are at most one cell wide, so look half a cell past the area
+		const float margin = cellSize_ / 2.f;
+
+		sf::Vector2i first = cellCoordinates(sf::Vector2f(area.left - margin, area.top - margin));
+		sf::Vector2i last = cellCoordinates(sf::Vector2f(area.left + area.width + margin, area.top + area.height + margin));
+
+		for (int y = first.y; y <= last.y; ++y)
+		{
+			for (int x = first.x; x <= last.x; ++x)
+			{
+				auto cell = cells_.find(cellKey(x, y));
+
+				if (cell == cells_.end())
+					continue;
+
+				for (std::size_t i : cell->second.entries)
+				{
+					if (boxes_[i].intersects(area))
+						found.push_back(nodes_[i]);
+				}
+			}
+		}
+
+		for (std::size_t i : oversized_)
+		{
+			if (boxes_[i].intersects(area))
+				found.push_back(nodes_[i]);
+		}
+	}
+
+	void SpatialHashGrid::setIgnoredCategories(unsigned int categories)
+	{
+		ignoredCategories_ = categories;
+	}
+
+	float SpatialHashGrid::getCellSize() const
+	{
+		return cellSize_;
+	}
+
+	std::size_t SpatialHashGrid::getNodeCount() const
+	{
+		return nodes_.size();
+	}
+
+	SpatialHashGrid::CellKey SpatialHashGrid::cellKey(int x, int y) const
+	{
+		//Through unsigned 32 bit first, shifting a negative signed value is undefined
+		return (static_cast<CellKey>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+	}
+
+	sf::Vector2i SpatialHashGrid::cellCoordinates(sf::Vector2f position) const
+	{
+		return sf::Vector2i(static_cast<int>(std::floor(position.x / cellSize_)),
+							static_cast<int>(std::floor(position.y / cellSize_)));
+	}
+
+	void SpatialHashGrid::testCell(const Cell& cell, std::set<SceneNode::Pair>& collisionPairs) const
+	{
+		for (std::size_t i = 0; i < cell.entries.size(); ++i)
+		{
+			for (std::size_t j = i + 1; j < cell.entries.size(); ++j)
+				testPair(cell.entries[i], cell.entries[j], collisionPairs);
+		}
+	}
+
+	void SpatialHashGrid::testCells(const Cell& lhs, const Cell& rhs, std::set<SceneNode::Pair>& collisionPairs) const
+	{
+		for (std::size_t i : lhs.entries)
+		{
+			for (std::size_t j : rhs.entries)
+				testPair(i, j, collisionPairs);
+		}
+	}
+
+	void SpatialHashGrid::testPair(std::size_t lhs, std::size_t rhs, std::set<SceneNode::Pair>& collisionPairs) const
+	{
+		if (categories_[lhs] & categories_[rhs] & ignoredCategories_)
+			return;
+
+		if (lhs != rhs && boxes_[lhs].intersects(boxes_[rhs]))
+			collisionPairs.insert(std::minmax(nodes_[lhs], nodes_[rhs]));
+	}
+}
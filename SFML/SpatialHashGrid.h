@@ -0,0 +1,96 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpatialHashGrid Class
+* Uniform grid broad-phase used to find colliding SceneNodes
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "SceneNode.h"
+
+namespace GEX
+{
+	class SpatialHashGrid
+	{
+	public:
+		explicit							SpatialHashGrid(float cellSize);
+
+		void								clear();
+		void								insert(SceneNode& node);
+
+		void								findPairs(std::set<SceneNode::Pair>& collisionPairs) const;
+		void								query(const sf::FloatRect& area, std::vector<SceneNode*>& found) const;
+
+			//pairs whose nodes share one of these categories are not reported, e.g. crowds that steer apart themselves
+		void								setIgnoredCategories(unsigned int categories);
+
+		float								getCellSize() const;
+		std::size_t							getNodeCount() const;
+
+	private:
+		using CellKey = std::uint64_t;
+
+		struct Cell
+		{
+			std::vector<std::size_t>		entries;
+		};
+
+	private:
+		CellKey								cellKey(int x, int y) const;
+		sf::Vector2i						cellCoordinates(sf::Vector2f position) const;
+
+		void								testCell(const Cell& cell, std::set<SceneNode::Pair>& collisionPairs) const;
+		void								testCells(const Cell& lhs, const Cell& rhs, std::set<SceneNode::Pair>& collisionPairs) const;
+		void								testPair(std::size_t lhs, std::size_t rhs, std::set<SceneNode::Pair>& collisionPairs) const;
+
+	private:
+		float								cellSize_;
+
+		std::vector<SceneNode*>				nodes_;
+		std::vector<sf::FloatRect>			boxes_;
+		std::vector<unsigned int>			categories_;
+		unsigned int						ignoredCategories_;
+
+		std::unordered_map<CellKey, Cell>	cells_;
+		std::vector<CellKey>				occupiedCells_;
+
+		// nodes bigger than one cell can't rely on the neighbour test, so they are checked against everything
+		std::vector<std::size_t>			oversized_;
+	};
+}
@@ -0,0 +1,233 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpawnDirector Class
+* Runs the zombie waves from the wave table, spawning at fixed points from a pre-built reserve
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "SpawnDirector.h"
+#include "Random.h"
+#include "SceneNode.h"
+#include "TextureManager.h"
+#include "ZombieHorde.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace GEX
+{
+	namespace
+	{
+		const std::vector<WaveData> TABLE = initializeWaveData();
+
+		// Spawn points per view edge, and how far outside the view they sit
+		const std::size_t SPAWN_POINTS_PER_EDGE = 3;
+		const float SPAWN_OFFSET = 50.f;
+
+		// Spreads a burst over a few ticks instead of one long frame
+		const std::size_t MAX_SPAWNS_PER_TICK = 8;
+		const std::size_t MAX_BUILDS_PER_TICK = 8;
+
+		// Past the end of the table the last wave repeats with a quarter more zombies each time,
+		// its alive cap stays put so the horde and the reserve never outgrow the last wave
+		const float ENDLESS_GROWTH = 0.25f;
+
+		WaveData makeWaveData(std::size_t wave)
+		{
+			WaveData data = TABLE[std::min(wave, TABLE.size()) - 1];
+
+			if (wave > TABLE.size())
+			{
+				float growth = 1.f + ENDLESS_GROWTH * (wave - TABLE.size());
+				data.budget = static_cast<std::size_t>(data.budget * growth);
+			}
+
+			return data;
+		}
+	}
+
+	SpawnDirector::SpawnDirector(const TextureManager& textures, Random& random)
+	: textures_(textures)
+	, random_(random)
+	, view_()
+	, spawnPoints_()
+	, wave_(0)
+	, waveData_()
+	, waveTime_(sf::Time::Zero)
+	, spawned_(0)
+	, isResting_(false)
+	, restTime_(sf::Time::Zero)
+	, reserve_()
+	{
+		assert(!TABLE.empty());
+
+		startWave(1);
+		spawnPoints_.reserve(4 * SPAWN_POINTS_PER_EDGE);
+	}
+
+	void SpawnDirector::setView(const sf::FloatRect& view)
+	{
+		if (view == view_ && !spawnPoints_.empty())
+			return;
+
+		view_ = view;
+		spawnPoints_.clear();
+
+		for (std::size_t i = 0; i < SPAWN_POINTS_PER_EDGE; ++i)
+		{
+			float along = (i + 1.f) / (SPAWN_POINTS_PER_EDGE + 1.f);
+			float x = view.left + along * view.width;
+			float y = view.top + along * view.height;
+
+			spawnPoints_.emplace_back(view.left - SPAWN_OFFSET, y);
+			spawnPoints_.emplace_back(view.left + view.width + SPAWN_OFFSET, y);
+			spawnPoints_.emplace_back(x, view.top - SPAWN_OFFSET);
+			spawnPoints_.emplace_back(x, view.top + view.height + SPAWN_OFFSET);
+		}
+	}
+
+	const std::vector<sf::Vector2f>& SpawnDirector::getSpawnPoints() const
+	{
+		return spawnPoints_;
+	}
+
+	void SpawnDirector::update(sf::Time dt, SceneNode& layer, ZombieHorde& horde)
+	{
+		assert(!spawnPoints_.empty());
+
+		std::size_t alive = horde.getAliveCount();
+
+		if (isResting_)
+		{
+			restTime_ += dt;
+			if (restTime_ >= waveData_.rest)
+				startWave(wave_ + 1);
+		}
+		else
+		{
+			waveTime_ += dt;
+
+			//how much of the budget the ramp has released by now
+			float progress = std::min(waveTime_ / waveData_.duration, 1.f);
+			std::size_t due = static_cast<std::size_t>(waveData_.budget * std::pow(progress, waveData_.ramp));
+
+			for (std::size_t count = 0; spawned_ < due && alive < waveData_.aliveCap && count < MAX_SPAWNS_PER_TICK; ++count)
+			{
+				const sf::Vector2f& point = spawnPoints_[random_.nextInt(static_cast<int>(spawnPoints_.size()))];
+				spawn(waveData_.type, point, layer, horde);
+
+				++spawned_;
+				++alive;
+			}
+
+			if (spawned_ >= waveData_.budget && alive == 0)
+			{
+				isResting_ = true;
+				restTime_ = sf::Time::Zero;
+			}
+		}
+
+		refillReserve();
+	}
+
+	std::unique_ptr<Zombie> SpawnDirector::acquire(Zombie::ZombieType type)
+	{
+		auto& reserve = reserve_[type];
+
+		if (reserve.empty())
+			return std::unique_ptr<Zombie>(new Zombie(type, textures_, random_));
+
+		std::unique_ptr<Zombie> zombie = std::move(reserve.back());
+		reserve.pop_back();
+
+		return zombie;
+	}
+
+	void SpawnDirector::spawn(Zombie::ZombieType type, sf::Vector2f position, SceneNode& layer, ZombieHorde& horde)
+	{
+		std::unique_ptr<Zombie> zombie = acquire(type);
+		zombie->setPosition(position);
+		horde.add(*zombie);
+		layer.attachChild(std::move(zombie));
+	}
+
+	std::size_t SpawnDirector::getWave() const
+	{
+		return wave_;
+	}
+
+	bool SpawnDirector::isResting() const
+	{
+		return isResting_;
+	}
+
+	std::size_t SpawnDirector::getReserveCount() const
+	{
+		std::size_t count = 0;
+
+		for (const auto& pair : reserve_)
+			count += pair.second.size();
+
+		return count;
+	}
+
+	void SpawnDirector::startWave(std::size_t wave)
+	{
+		wave_ = wave;
+		waveData_ = makeWaveData(wave);
+
+		waveTime_ = sf::Time::Zero;
+		spawned_ = 0;
+		isResting_ = false;
+		restTime_ = sf::Time::Zero;
+	}
+
+	//Enough zombies for the alive cap, or for what is left of the budget, built a few per tick.
+	//While resting, the next wave is the one to get ready for
+	void SpawnDirector::refillReserve()
+	{
+		Zombie::ZombieType type = waveData_.type;
+		std::size_t left = waveData_.budget - std::min(spawned_, waveData_.budget);
+		std::size_t wanted = std::min(waveData_.aliveCap, left);
+
+		if (isResting_)
+		{
+			WaveData next = makeWaveData(wave_ + 1);
+			type = next.type;
+			wanted = std::min(next.aliveCap, next.budget);
+		}
+
+		auto& reserve = reserve_[type];
+		for (std::size_t count = 0; reserve.size() < wanted && count < MAX_BUILDS_PER_TICK; ++count)
+			reserve.emplace_back(new Zombie(type, textures_, random_));
+	}
+}
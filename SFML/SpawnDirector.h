@@ -0,0 +1,99 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpawnDirector Class
+* Runs the zombie waves from the wave table, spawning at fixed points from a pre-built reserve
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "DataTables.h"
+#include "Zombie.h"
+
+namespace GEX
+{
+	// forward declarations
+	class SceneNode;
+	class ZombieHorde;
+	class Random;
+	class TextureManager;
+
+	// Zombies are built ahead of time, a few per tick, into a reserve; a spawn only positions one
+	// and attaches it, so a burst of a wave costs no allocation or texture lookups on that tick
+	class SpawnDirector
+	{
+	public:
+									SpawnDirector(const TextureManager& textures, Random& random);
+
+			//spawn points sit just outside the view, they are only rebuilt when it changes
+		void						setView(const sf::FloatRect& view);
+		const std::vector<sf::Vector2f>&	getSpawnPoints() const;
+
+			//advances the wave, spawns what is due and tops the reserve up
+		void						update(sf::Time dt, SceneNode& layer, ZombieHorde& horde);
+
+			//a zombie from the reserve, or a new one when the reserve ran dry
+		std::unique_ptr<Zombie>		acquire(Zombie::ZombieType type);
+		void						spawn(Zombie::ZombieType type, sf::Vector2f position, SceneNode& layer, ZombieHorde& horde);
+
+		std::size_t					getWave() const;		// counted from 1
+		bool						isResting() const;
+		std::size_t					getReserveCount() const;
+
+	private:
+		void						startWave(std::size_t wave);
+		void						refillReserve();
+
+	private:
+		const TextureManager&		textures_;
+		Random&						random_;
+
+		sf::FloatRect				view_;
+		std::vector<sf::Vector2f>	spawnPoints_;
+
+		std::size_t					wave_;
+		WaveData					waveData_;
+		sf::Time					waveTime_;
+		std::size_t					spawned_;
+		bool						isResting_;
+		sf::Time					restTime_;
+
+		std::map<Zombie::ZombieType, std::vector<std::unique_ptr<Zombie>>>	reserve_;
+	};
+}
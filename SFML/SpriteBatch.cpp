@@ -0,0 +1,153 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpriteBatch Class
+* Collects textured quads and draws them in as few calls as possible
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "SpriteBatch.h"
+#include "Animation.h"
+#include "AnimationClip.h"
+
+#include <cmath>
+
+namespace GEX
+{
+	SpriteBatch::SpriteBatch(sf::RenderTarget& target)
+		: target_(target)
+		, texture_(nullptr)
+		, blendMode_()
+		, vertices_(sf::Quads)
+		, drawCalls_(0)
+	{
+	}
+
+	void SpriteBatch::draw(const sf::Sprite& sprite, sf::RenderStates states)
+	{
+		//Shaders can't be merged, and an untextured sprite has nothing to batch on
+		if (states.shader || !sprite.getTexture())
+		{
+			draw(static_cast<const sf::Drawable&>(sprite), states);
+			return;
+		}
+
+		append(*sprite.getTexture(), sprite.getTextureRect(), sprite.getColor(), states.transform * sprite.getTransform(), states.blendMode);
+	}
+
+	void SpriteBatch::draw(const AnimationClip& clip, sf::Time elapsed, sf::RenderStates states)
+	{
+		const sf::IntRect& rect = clip.getFrameAt(elapsed);
+		states.transform.translate(-clip.getOrigin());
+
+		//Same fallback as a sprite, the batched path reads the frame straight from the clip
+		if (states.shader || !clip.getTexture())
+		{
+			sf::Sprite sprite;
+			sprite.setTextureRect(rect);
+			if (clip.getTexture())
+				sprite.setTexture(*clip.getTexture());
+
+			draw(static_cast<const sf::Drawable&>(sprite), states);
+			return;
+		}
+
+		append(*clip.getTexture(), rect, sf::Color::White, states.transform, states.blendMode);
+	}
+
+	void SpriteBatch::draw(const Animation& animation, sf::RenderStates states)
+	{
+		states.transform *= animation.getTransform();
+		draw(animation.getSprite(), states);
+	}
+
+	void SpriteBatch::draw(const sf::Drawable& drawable, sf::RenderStates states)
+	{
+		flush();
+
+		target_.draw(drawable, states);
+		++drawCalls_;
+	}
+
+	void SpriteBatch::flush()
+	{
+		if (vertices_.getVertexCount() == 0)
+			return;
+
+		sf::RenderStates states;
+		states.texture = texture_;
+		states.blendMode = blendMode_;
+
+		target_.draw(vertices_, states);
+		++drawCalls_;
+
+		vertices_.clear();
+	}
+
+	sf::RenderTarget& SpriteBatch::getTarget() const
+	{
+		return target_;
+	}
+
+	std::size_t SpriteBatch::getDrawCallCount() const
+	{
+		return drawCalls_;
+	}
+
+	void SpriteBatch::resetDrawCallCount()
+	{
+		drawCalls_ = 0;
+	}
+
+	void SpriteBatch::append(const sf::Texture& texture, const sf::IntRect& rect, const sf::Color& color,
+							 const sf::Transform& transform, const sf::BlendMode& blendMode)
+	{
+		const float width = static_cast<float>(std::abs(rect.width));
+		const float height = static_cast<float>(std::abs(rect.height));
+
+		const float left = static_cast<float>(rect.left);
+		const float top = static_cast<float>(rect.top);
+		const float right = left + rect.width;
+		const float bottom = top + rect.height;
+
+		//Only neighbours in draw order merge, anything else would reorder overlapping sprites
+		if (&texture != texture_ || blendMode != blendMode_)
+		{
+			flush();
+			texture_ = &texture;
+			blendMode_ = blendMode;
+		}
+
+		vertices_.append(sf::Vertex(transform.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top)));
+		vertices_.append(sf::Vertex(transform.transformPoint(width, 0.f), color, sf::Vector2f(right, top)));
+		vertices_.append(sf::Vertex(transform.transformPoint(width, height), color, sf::Vector2f(right, bottom)));
+		vertices_.append(sf::Vertex(transform.transformPoint(0.f, height), color, sf::Vector2f(left, bottom)));
+	}
+}
@@ -0,0 +1,85 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpriteBatch Class
+* Collects textured quads and draws them in as few calls as possible
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Time.hpp>
+
+
+namespace GEX
+{
+	// forward declaration
+	class Animation;
+	class AnimationClip;
+
+	// Consecutive sprites sharing a texture and blend mode are queued and drawn together; a sprite
+	// with other states, or anything else, flushes the queue first, so draw order is kept exactly
+	class SpriteBatch
+	{
+	public:
+		explicit					SpriteBatch(sf::RenderTarget& target);
+
+		void						draw(const sf::Sprite& sprite, sf::RenderStates states);
+		void						draw(const Animation& animation, sf::RenderStates states);
+		void						draw(const AnimationClip& clip, sf::Time elapsed, sf::RenderStates states);
+		void						draw(const sf::Drawable& drawable, sf::RenderStates states);
+
+		void						flush();
+
+		sf::RenderTarget&			getTarget() const;
+
+			//draw calls issued to the target since the last reset
+		std::size_t					getDrawCallCount() const;
+		void						resetDrawCallCount();
+
+	private:
+		void						append(const sf::Texture& texture, const sf::IntRect& rect, const sf::Color& color,
+										   const sf::Transform& transform, const sf::BlendMode& blendMode);
+
+	private:
+		sf::RenderTarget&			target_;
+
+		// The queue keeps its vertex storage across flushes so it is reused every frame
+		const sf::Texture*			texture_;
+		sf::BlendMode				blendMode_;
+		sf::VertexArray				vertices_;
+		std::size_t					drawCalls_;
+	};
+}
@@ -33,7 +33,8 @@
 */
 
 #include "SpriteNode.h"
-#include <SFML\Graphics.hpp>
+#include "SpriteBatch.h"
+#include <SFML/Graphics.hpp>
 
 
 namespace GEX
@@ -44,8 +45,13 @@ namespace GEX
 	SpriteNode::SpriteNode(const sf::Texture & texture, const sf::IntRect & textureRect) : sprite_(texture, textureRect)
 	{}
 
-	void SpriteNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	sf::FloatRect SpriteNode::computeDrawBounds() const
 	{
-		target.draw(sprite_, states);
+		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
+	}
+
+	void SpriteNode::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
+	{
+		batch.draw(sprite_, states);
 	}
 }
\ No newline at end of file
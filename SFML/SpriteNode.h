@@ -35,7 +35,7 @@
 #pragma once
 
 #include "SceneNode.h"
-#include <SFML\Graphics\Sprite.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
 namespace GEX
 {
@@ -45,8 +45,11 @@ namespace GEX
 		explicit		 SpriteNode(const sf::Texture& texture);
 						 SpriteNode(const sf::Texture& texture, const sf::IntRect& textureRect);
 
+	protected:
+		sf::FloatRect	 computeDrawBounds() const override;
+
 	private:
-		virtual void	 drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		virtual void	 drawCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
 	private:
 		sf::Sprite		 sprite_;
@@ -59,6 +59,11 @@ namespace GEX
 	State::~State()
 	{}
 
+	void State::setInterpolation(float alpha)
+	{
+		//default to do nothing.
+	}
+
 	void State::requestStackPush(StateID stateID)
 	{
 		stack_->pushState(stateID);
@@ -83,6 +83,9 @@ namespace GEX
 		virtual bool	update(sf::Time dt) = 0;
 		virtual bool	handleEvent(const sf::Event& event) = 0;
 
+			//fraction of a tick the next draw lies past the last update, states that interpolate override this
+		virtual void	setInterpolation(float alpha);
+
 	protected:
 		void			requestStackPush(StateID stateID);
 		void			requestStackPop();
@@ -33,6 +33,7 @@
 */
 
 #include "StateStack.h"
+#include "Profiler.h"
 
 #include <cassert>
 
@@ -53,6 +54,8 @@ namespace GEX
 
 	void StateStack::update(sf::Time dt)
 	{
+		GEX_PROFILE_SCOPE("StateStack::update");
+
 		for (auto itr = stack_.rbegin(); itr != stack_.rend(); ++itr)
 		{
 			if (!(*itr)->update(dt))
@@ -62,10 +65,18 @@ namespace GEX
 
 	void StateStack::draw()
 	{
+		GEX_PROFILE_SCOPE("StateStack::draw");
+
 		for (State::Ptr& state : stack_)
 			state->draw();
 	}
 
+	void StateStack::setInterpolation(float alpha)
+	{
+		for (State::Ptr& state : stack_)
+			state->setInterpolation(alpha);
+	}
+
 	void StateStack::handleEvent(const sf::Event & event)
 	{
 		for (auto itr = stack_.rbegin(); itr != stack_.rend(); ++itr)
@@ -67,6 +67,7 @@ namespace GEX
 
 		void						update(sf::Time dt);
 		void						draw();
+		void						setInterpolation(float alpha);
 		void						handleEvent(const sf::Event& event);
 
 		void						pushState(GEX::StateID stateID);
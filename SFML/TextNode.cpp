@@ -35,13 +35,17 @@
 #include "TextNode.h"
 #include "FontManager.h"
 #include "Utility.h"
+#include "SpriteBatch.h"
 
-#include <SFML\Graphics\RenderTarget.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 
 
 TextNode::TextNode(const std::string & text)
 {
-	text_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Spooky));
+	//Headless runs never load fonts, the text is then kept but never laid out
+	if (const sf::Font* font = GEX::FontManager::getInstance().find(GEX::FontID::Spooky))
+		text_.setFont(*font);
+
 	text_.setCharacterSize(20);
 	setString(text);
 }
@@ -50,9 +54,15 @@ void TextNode::setString(const std::string & text)
 {
 	text_.setString(text);
 	GEX::centerOrigin(text_);
+	invalidateBoundingBox();
+}
+
+sf::FloatRect TextNode::computeDrawBounds() const
+{
+	return getWorldTransform().transformRect(text_.getGlobalBounds());
 }
 
-void TextNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+void TextNode::drawCurrent(GEX::SpriteBatch& batch, sf::RenderStates states) const
 {
-	target.draw(text_, states);
+	batch.draw(text_, states);
 }
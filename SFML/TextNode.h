@@ -37,7 +37,7 @@
 #include "SceneNode.h"
 #include "FontManager.h"
 
-#include <SFML\Graphics\Text.hpp>
+#include <SFML/Graphics/Text.hpp>
 
 #include <string>
 
@@ -48,8 +48,11 @@ public:
 
 	void				setString(const std::string& text);
 
+protected:
+	sf::FloatRect		computeDrawBounds() const override;
+
 private:
-	virtual void		drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void		drawCurrent(GEX::SpriteBatch& batch, sf::RenderStates states) const;
 
 private:
 	sf::Text			text_;
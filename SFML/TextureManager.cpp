@@ -33,13 +33,41 @@
 */
 
 #include "TextureManager.h"
+#include <algorithm>
+#include <fstream>
 #include <stdexcept>
 #include <cassert>
 
 namespace GEX
 { 
+	namespace
+	{
+		//Reads the dimensions from a PNG header without decoding any pixels
+		sf::Vector2u readImageSize(const std::string& path)
+		{
+			const unsigned char SIGNATURE[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+			std::ifstream file(path, std::ios::binary);
+			unsigned char header[24];
+
+			if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) || !std::equal(SIGNATURE, SIGNATURE + 8, header))
+				throw std::runtime_error("Texture size could not be read from " + path);
+
+			// Width and height are the first two big endian fields of the IHDR chunk
+			auto readUint32 = [&header](std::size_t offset)
+			{
+				return (static_cast<unsigned int>(header[offset]) << 24) | (header[offset + 1] << 16) | (header[offset + 2] << 8) | header[offset + 3];
+			};
 
-	TextureManager::TextureManager()
+			return sf::Vector2u(readUint32(16), readUint32(20));
+		}
+	}
+
+	TextureManager::TextureManager(Mode mode)
+		: mode_(mode)
+		, textures_()
+		, atlasPages_()
+		, regions_()
 	{
 	}
 
@@ -50,6 +78,15 @@ namespace GEX
 
 	void TextureManager::load(TextureID id, const std::string & path)
 	{
+		if (mode_ == Mode::Headless)
+		{
+			sf::Vector2u size = readImageSize(path);
+
+			auto rc = regions_.insert(std::make_pair(id, Region{ nullptr, sf::IntRect(0, 0, size.x, size.y) }));
+			assert(rc.second);
+			return;
+		}
+
 		std::unique_ptr<sf::Texture> texture(new sf::Texture());
 
 		if (!texture->loadFromFile(path))
@@ -57,17 +94,176 @@ namespace GEX
 			throw std::runtime_error("Texture failed to load from " + path);
 		}
 
+		sf::IntRect rect(0, 0, texture->getSize().x, texture->getSize().y);
+		regions_[id] = Region{ texture.get(), rect };
+
 		auto rc = textures_.insert(std::make_pair(id, std::move(texture)));
 		assert(rc.second);
 	}
 
 	sf::Texture& TextureManager::get(TextureID id) const
 	{
-		auto found = textures_.find(id);
+		const sf::Texture* texture = find(id);
+
+		assert(texture);
+
+		return *const_cast<sf::Texture*>(texture);
+	}
+
+	const sf::Texture* TextureManager::find(TextureID id) const
+	{
+		auto found = regions_.find(id);
 
-		assert(found != textures_.end());
+		assert(found != regions_.end());
 
-		return *(found->second);
+		return found->second.texture;
 	}
 
+	const sf::IntRect& TextureManager::getTextureRect(TextureID id) const
+	{
+		auto found = regions_.find(id);
+
+		assert(found != regions_.end());
+
+		return found->second.rect;
+	}
+
+	void TextureManager::packAtlas(const std::vector<TextureID>& ids)
+	{
+		//Without pixels there is nothing to pack, every image keeps its own rect
+		if (mode_ == Mode::Headless)
+			return;
+
+		const unsigned int PAGE_SIZE = std::min(sf::Texture::getMaximumSize(), 2048u);
+		const unsigned int PADDING = 1;
+
+		struct Placement
+		{
+			TextureID		id;
+			sf::Vector2u	size;
+			std::size_t		page;
+			sf::Vector2u	position;
+		};
+
+		std::vector<Placement> placements;
+
+		for (TextureID id : ids)
+		{
+			sf::Vector2u size = textures_.at(id)->getSize();
+
+			// Anything too large for a page stays a texture of its own
+			if (size.x + PADDING <= PAGE_SIZE && size.y + PADDING <= PAGE_SIZE)
+				placements.push_back(Placement{ id, size, 0, sf::Vector2u() });
+		}
+
+		// Shelf packing, tallest first keeps the wasted space above shorter sheets small
+		std::sort(placements.begin(), placements.end(), [](const Placement& lhs, const Placement& rhs)
+		{
+			return lhs.size.y > rhs.size.y;
+		});
+
+		std::vector<sf::Vector2u> pageSizes(1);
+		sf::Vector2u cursor;
+		unsigned int shelfHeight = 0;
+
+		for (Placement& placement : placements)
+		{
+			// Start a new shelf when the row is full
+			if (cursor.x + placement.size.x + PADDING > PAGE_SIZE)
+			{
+				cursor.x = 0;
+				cursor.y += shelfHeight;
+				shelfHeight = 0;
+			}
+
+			// Start a new page when the shelf doesn't fit below the last one
+			if (cursor.y + placement.size.y + PADDING > PAGE_SIZE)
+			{
+				pageSizes.push_back(sf::Vector2u());
+				cursor = sf::Vector2u();
+				shelfHeight = 0;
+			}
+
+			placement.page = pageSizes.size() - 1;
+			placement.position = cursor;
+
+			cursor.x += placement.size.x + PADDING;
+			shelfHeight = std::max(shelfHeight, placement.size.y + PADDING);
+
+			sf::Vector2u& pageSize = pageSizes.back();
+			pageSize.x = std::max(pageSize.x, cursor.x);
+			pageSize.y = std::max(pageSize.y, cursor.y + shelfHeight);
+		}
+
+		if (placements.empty())
+			return;
+
+		std::size_t firstPage = atlasPages_.size();
+
+		for (sf::Vector2u pageSize : pageSizes)
+		{
+			std::unique_ptr<sf::Texture> page(new sf::Texture());
+
+			if (!page->create(pageSize.x, pageSize.y))
+				throw std::runtime_error("Texture atlas page could not be created");
+
+			atlasPages_.push_back(std::move(page));
+		}
+
+		// Copy every sheet into its page and drop the standalone texture
+		for (const Placement& placement : placements)
+		{
+			sf::Texture& page = *atlasPages_[firstPage + placement.page];
+			page.update(textures_.at(placement.id)->copyToImage(), placement.position.x, placement.position.y);
+
+			sf::IntRect rect(placement.position.x, placement.position.y, placement.size.x, placement.size.y);
+			regions_[placement.id] = Region{ &page, rect };
+
+			textures_.erase(placement.id);
+		}
+	}
+
+
+	sf::Sprite TextureManager::createSprite(TextureID id) const
+	{
+		const sf::IntRect& rect = getTextureRect(id);
+		return createSprite(id, sf::IntRect(0, 0, rect.width, rect.height));
+	}
+
+	sf::Sprite TextureManager::createSprite(TextureID id, const sf::IntRect& rect) const
+	{
+		const sf::IntRect& region = getTextureRect(id);
+
+		sf::Sprite sprite;
+
+		// A headless sprite still carries its rect, so bounds stay correct
+		if (const sf::Texture* texture = find(id))
+			sprite.setTexture(*texture);
+
+		sprite.setTextureRect(sf::IntRect(region.left + rect.left, region.top + rect.top, rect.width, rect.height));
+
+		return sprite;
+	}
+
+	void TextureManager::loadClip(AnimationID id, TextureID texture, sf::Vector2i frameSize,
+								  std::size_t numFrames, sf::Time duration, bool repeat)
+	{
+		//Frame rects point into the texture as it is now, packing later would leave them behind
+		clips_.erase(id);
+		clips_.emplace(id, AnimationClip(find(texture), getTextureRect(texture), frameSize, numFrames, duration, repeat));
+	}
+
+	const AnimationClip& TextureManager::getClip(AnimationID id) const
+	{
+		auto found = clips_.find(id);
+
+		assert(found != clips_.end());
+
+		return found->second;
+	}
+
+	TextureManager::Mode TextureManager::getMode() const
+	{
+		return mode_;
+	}
 }
\ No newline at end of file
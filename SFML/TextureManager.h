@@ -36,24 +36,63 @@
 #pragma once
 
 #include "ResourceIdentifiers.h"
+#include "AnimationClip.h"
 
 #include <map>
 #include <memory>
-#include <SFML\Graphics.hpp>
+#include <vector>
+#include <SFML/Graphics.hpp>
 
 namespace GEX 
 {
 	class TextureManager
 	{
 	public:
-															TextureManager();
+		enum class Mode
+		{
+			Full,
+			Headless		// only image sizes are read, no pixels are decoded and no textures are created
+		};
+
+	public:
+		explicit											TextureManager(Mode mode = Mode::Full);
 															~TextureManager();
 
 		void												load(TextureID id, const std::string& path);
 		sf::Texture&										get(TextureID id) const;
+		const sf::Texture*									find(TextureID id) const;
+
+			//area of get(id) holding the image, the whole texture unless it was packed into an atlas
+		const sf::IntRect&									getTextureRect(TextureID id) const;
+
+			//copy the listed textures into as few atlas pages as possible, get() then hands out the page
+		void												packAtlas(const std::vector<TextureID>& ids);
+
+			//sprites cut from a texture, or from its atlas page, rect is relative to the original image
+		sf::Sprite											createSprite(TextureID id) const;
+		sf::Sprite											createSprite(TextureID id, const sf::IntRect& rect) const;
+
+			//cut a clip from a loaded texture once, after packing, every entity then shares it
+		void												loadClip(AnimationID id, TextureID texture, sf::Vector2i frameSize,
+																	 std::size_t numFrames, sf::Time duration, bool repeat);
+		const AnimationClip&								getClip(AnimationID id) const;
+
+		Mode												getMode() const;
 
 	private:
+		struct Region
+		{
+			sf::Texture*									texture;
+			sf::IntRect										rect;
+		};
+
+	private:
+		Mode												mode_;
+
 		std::map<TextureID, std::unique_ptr<sf::Texture>>	textures_;
+		std::vector<std::unique_ptr<sf::Texture>>			atlasPages_;
+		std::map<TextureID, Region>							regions_;
+		std::map<AnimationID, AnimationClip>				clips_;
 	};
 }
 
@@ -34,10 +34,10 @@
 
 #include "Utility.h"
 
-#include <SFML\Graphics\Sprite.hpp>
-#include <SFML\Graphics\Text.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
 
-#include <random>
+#include <algorithm>
 
 #define _USE_MATH_DEFINES
 #include <cmath>
@@ -76,15 +76,6 @@ namespace GEX
 		return static_cast<float>(M_PI) / 180.f * degree;
 	}
 
-	int randomInt(int exclusiveMax)
-	{
-		std::random_device rd;
-		std::mt19937 rng(rd());
-		std::uniform_int_distribution<int> uni(0, exclusiveMax - 1);
-
-		return uni(rng);
-	}
-
 	float length(sf::Vector2f vector)
 	{
 		return std::sqrt((vector.x * vector.x) + (vector.y * vector.y));
@@ -95,4 +86,47 @@ namespace GEX
 		assert(vector != sf::Vector2f(0.f, 0.f));
 		return vector / length(vector);
 	}
+
+	bool sweptIntersects(const sf::FloatRect& box, sf::Vector2f displacement, const sf::FloatRect& target, float& time)
+	{
+		//Grow the target by the box so the sweep reduces to the box's corner travelling along a segment
+		const sf::Vector2f origin(box.left, box.top);
+		const sf::Vector2f minimum(target.left - box.width, target.top - box.height);
+		const sf::Vector2f maximum(target.left + target.width, target.top + target.height);
+
+		float entry = 0.f;
+		float exit = 1.f;
+
+		const float start[] = { origin.x, origin.y };
+		const float delta[] = { displacement.x, displacement.y };
+		const float lower[] = { minimum.x, minimum.y };
+		const float upper[] = { maximum.x, maximum.y };
+
+		for (int axis = 0; axis < 2; ++axis)
+		{
+			if (delta[axis] == 0.f)
+			{
+				//Not moving on this axis, so it must already overlap the slab
+				if (start[axis] <= lower[axis] || start[axis] >= upper[axis])
+					return false;
+			}
+			else
+			{
+				float enter = (lower[axis] - start[axis]) / delta[axis];
+				float leave = (upper[axis] - start[axis]) / delta[axis];
+
+				if (enter > leave)
+					std::swap(enter, leave);
+
+				entry = std::max(entry, enter);
+				exit = std::min(exit, leave);
+
+				if (entry >= exit)
+					return false;
+			}
+		}
+
+		time = entry;
+		return true;
+	}
 }
\ No newline at end of file
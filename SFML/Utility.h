@@ -36,7 +36,8 @@
 
 #include "Animation.h"
 
-#include <SFML\System\Vector2.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
 
 namespace sf
 {
@@ -52,8 +53,9 @@ namespace GEX
 	float			toDegree(float radian);
 	float			toRadian(float degree);
 
-	int				randomInt(int exclusiveMax);
-
 	float			length(sf::Vector2f vector);
 	sf::Vector2f	unitVector(sf::Vector2f vector);
+
+	// Sweeps box along displacement and reports the earliest fraction of the move at which it touches target
+	bool			sweptIntersects(const sf::FloatRect& box, sf::Vector2f displacement, const sf::FloatRect& target, float& time);
 }
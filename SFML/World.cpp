@@ -39,42 +39,134 @@
 #include "Projectile.h"
 #include "SoundNode.h"
 #include "ParticleNode.h"
+#include "NodePool.h"
+#include "Profiler.h"
+#include "DataTables.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
 
 namespace GEX
 { 
-	World::World(sf::RenderWindow& window, SoundPlayer& sounds)
-	: target_(window)
+	namespace
+	{
+		// Must be at least as large as the biggest regular entity bounding box
+		const float COLLISION_CELL_SIZE = 64.f;
+
+		// Sized above the largest wave's alive cap and reserve plus corpses still playing their death animation
+		const std::size_t ZOMBIE_POOL_SIZE = 256;
+		const std::size_t PROJECTILE_POOL_SIZE = 128;
+		const std::size_t PICKUP_POOL_SIZE = 32;
+
+		// Zombies closer than a little over a body width push apart. Each reads at most this many
+		// zombies from the cells around it, about a third of which fall inside the radius
+		const float SEPARATION_RADIUS = 40.f;
+		const std::size_t SEPARATION_CANDIDATES = 32;
+
+		// The chase field reaches past the edges, where the spawn points sit
+		const float FLOW_FIELD_CELL_SIZE = 32.f;
+		const float FLOW_FIELD_MARGIN = 64.f;
+
+		// One lane per job a parallel phase splits its work into
+		const std::size_t COMMAND_STAGING_LANES = 8;
+
+		// Keyframe checksums mix in every value a desync would show up in first
+		const std::uint32_t FNV_OFFSET = 2166136261u;
+		const std::uint32_t FNV_PRIME = 16777619u;
+
+		void mix(std::uint32_t& hash, std::uint32_t value)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				hash ^= (value >> (i * 8)) & 0xffu;
+				hash *= FNV_PRIME;
+			}
+		}
+
+		void mix(std::uint32_t& hash, float value)
+		{
+			std::uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			mix(hash, bits);
+		}
+
+		bool isHandleLess(const EntityHandle& lhs, const EntityHandle& rhs)
+		{
+			return lhs.index != rhs.index ? lhs.index < rhs.index : lhs.generation < rhs.generation;
+		}
+	}
+
+	World::World(sf::RenderWindow& window, SoundPlayer& sounds, unsigned int seed)
+	: World(&window, &sounds, window.getDefaultView(), seed)
+	{
+	}
+
+	World::World(sf::Vector2f viewSize, unsigned int seed)
+	: World(nullptr, nullptr, sf::View(viewSize / 2.f, viewSize), seed)
+	{
+	}
+
+	World::World(sf::RenderTarget* target, SoundPlayer* sounds, const sf::View& view, unsigned int seed)
+	: seed_(seed)
+	, random_(seed)
+	, target_(target)
 	, sounds_(sounds)
-	, worldView_(window.getDefaultView())
-	, textures_()
+	, worldView_(view)
+	, textures_(target ? TextureManager::Mode::Full : TextureManager::Mode::Headless)
+	, categoryRegistry_()
+	, entityRegistry_()
+	, zombieHorde_()
+	, spawnDirector_(textures_, random_)
 	, sceneGraph_()
 	, sceneLayers_()
+	, spriteBatch_(target ? new SpriteBatch(*target) : nullptr)
+	, interpolation_(1.f)
+	, commandQueue_()
+	, commandStaging_(COMMAND_STAGING_LANES)
+	, collisionGrid_(COLLISION_CELL_SIZE)
+	, sweepCandidates_()
+	, orderedPairs_()
 	, worldBounds_(0.f, 0.f, worldView_.getSize().x, /*5000.f*/worldView_.getSize().y)
+	, chaseField_(sf::FloatRect(worldBounds_.left - FLOW_FIELD_MARGIN, worldBounds_.top - FLOW_FIELD_MARGIN,
+								worldBounds_.width + 2.f * FLOW_FIELD_MARGIN, worldBounds_.height + 2.f * FLOW_FIELD_MARGIN),
+				  FLOW_FIELD_CELL_SIZE)
 	, spawnPosition_(worldView_.getSize().x / 2.f, worldBounds_.height - worldView_.getSize().y / 2.f)
 	, scrollSpeed_(0.f)
-	, player_(nullptr)
+	, player_()
 	, scoreText_()
-	, activeZombies_()
 	, score_()
 	, multiplierText_()
 	, multiplier_(1)
-	, enemySpawnDelay_(sf::seconds(4.5f))
-	, enemySpawnTimer_(sf::Time::Zero)
-	, enemySpawnClock_()
-	{
-		//Score Text
-		scoreText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Spooky));
-		centerOrigin(scoreText_);
-		scoreText_.setPosition(worldView_.getSize().x / 2.f - 50.f, 20.f);
-		scoreText_.setCharacterSize(25);
-		scoreText_.setString("Score " + std::to_string(score_));
+	, phaseTimes_()
+	, enemySpawning_(true)
+	{
+		//The HUD needs fonts, which a headless world never loads
+		if (target_)
+		{
+			//Score Text
+			scoreText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Spooky));
+			centerOrigin(scoreText_);
+			scoreText_.setPosition(worldView_.getSize().x / 2.f - 50.f, 20.f);
+			scoreText_.setCharacterSize(25);
+			scoreText_.setString("Score " + std::to_string(score_));
+
+			//Multiplier Text
+			multiplierText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Spooky));
+			centerOrigin(multiplierText_);
+			multiplierText_.setPosition(worldView_.getSize().x / 2.f - 20.f, 50.f);
+			multiplierText_.setCharacterSize(25);
+			multiplierText_.setString("X" + std::to_string(multiplier_));
+		}
 
-		//Multiplier Text
-		multiplierText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Spooky));
-		centerOrigin(multiplierText_);
-		multiplierText_.setPosition(worldView_.getSize().x / 2.f - 20.f, 50.f);
-		multiplierText_.setCharacterSize(25);
-		multiplierText_.setString("X" + std::to_string(multiplier_));
+		//Preallocate node storage so spawning mid wave recycles blocks instead of hitting the heap
+		NodePool<Zombie>::getInstance().reserve(ZOMBIE_POOL_SIZE);
+		NodePool<Projectile>::getInstance().reserve(PROJECTILE_POOL_SIZE);
+		NodePool<Pickup>::getInstance().reserve(PICKUP_POOL_SIZE);
+
+		//The horde keeps itself apart, its pairs would only be thrown away
+		collisionGrid_.setIgnoredCategories(Category::Zombie);
 
 		loadTextures();
 
@@ -83,12 +175,25 @@ namespace GEX
 
 	void World::update(sf::Time dt, CommandQueue& commands)
 	{
-		//Setup enemy spawn points
-		setupSpawnPoints();
+		GEX_PROFILE_SCOPE("World::update");
+
+		sf::Clock phaseClock;
+		auto endPhase = [this, &phaseClock](UpdatePhase phase)
+		{
+			phaseTimes_[static_cast<std::size_t>(phase)] = phaseClock.restart();
+		};
+
+		//Remember where everything was so drawing can blend towards this tick's positions
+		{
+			GEX_PROFILE_SCOPE("SceneNode::storePreviousPosition");
+			sceneGraph_.storePreviousPosition();
+		}
 
 		// Scroll screen and reset player velocity
 		worldView_.move(0.f, scrollSpeed_ * dt.asSeconds());
-		player_->setVelocity(0.f, 0.f);
+
+		if (Player* player = getPlayer())
+			player->setVelocity(0.f, 0.f);
 
 		// Destroy all entities that leave the battlefield
 		destroyEntitiesOutOfView();
@@ -97,24 +202,46 @@ namespace GEX
 		//guideMissiles();
 
 		// Run all the commands in the command queue
-		while (!commandQueue_.isEmpty())
-		{ 
-			sceneGraph_.onCommand(commandQueue_.pop(), dt);
+		{
+			GEX_PROFILE_SCOPE("World::dispatchCommands");
+
+			commandStaging_.mergeInto(commandQueue_);
+			while (!commandQueue_.isEmpty())
+			{ 
+				//moved out, commands that run may push more and grow the queue
+				Command command = std::move(commandQueue_.front());
+				commandQueue_.pop();
+				categoryRegistry_.onCommand(command, dt);
+			}
 		}
 		adaptPlayerVelocity();
+		endPhase(UpdatePhase::Commands);
 
 		// Handle collisions
-		handleCollision();
+		handleCollision(dt);
 
-		// Destroy all wrecks on the battlefield
-		sceneGraph_.removeWrecks();
+		// Destroy all wrecks on the battlefield, freed zombies leave the horde on their own
+		{
+			GEX_PROFILE_SCOPE("SceneNode::removeWrecks");
+			sceneGraph_.removeWrecks();
+		}
+		endPhase(UpdatePhase::Collision);
 
 		// Spawn enemies
-		spawnEnemies();
+		spawnEnemies(dt);
+		endPhase(UpdatePhase::Spawning);
 
-		// Regular update step, and adapt position of aircraft
-		sceneGraph_.update(dt, getCommandQueue());
+		// Move the horde, then the regular update step, and adapt position of aircraft
+		{
+			GEX_PROFILE_SCOPE("ZombieHorde::update");
+			zombieHorde_.update(dt);
+		}
+		{
+			GEX_PROFILE_SCOPE("SceneNode::update");
+			sceneGraph_.update(dt, getCommandQueue());
+		}
 		adaptPlayerPosition();
+		endPhase(UpdatePhase::Movement);
 
 		//Update sound
 		updateSound();
@@ -122,76 +249,89 @@ namespace GEX
 		//Update score and multiplier texts
 		updateScoreAndMultiplier();
 
-		//Clean active enemy vector
-		cleanEnemyVector();
-		
-		//Make enemies chase the player
-		enemiesChasePlayer();
-
 		//Play a zombie groan at regular intervals
-		playZombieGroan();
+		playZombieGroan(dt);
+		endPhase(UpdatePhase::Presentation);
+
+		//Make enemies chase the player, then keep the crowd from stacking up
+		enemiesChasePlayer();
+		{
+			GEX_PROFILE_SCOPE("ZombieHorde::separate");
+			zombieHorde_.separate(SEPARATION_RADIUS, SEPARATION_CANDIDATES);
+		}
+		endPhase(UpdatePhase::Steering);
 	}
 
 	//Update score and multiplier labels
 	void World::updateScoreAndMultiplier()
 	{
+		GEX_PROFILE_SCOPE("World::updateScoreAndMultiplier");
+
 		scoreText_.setString("Score " + std::to_string(score_));
 		multiplierText_.setString("X" + std::to_string(multiplier_));
 	}
 
-	//Clean the vector of active enemies. Remove the enemy if they are dead
-	void World::cleanEnemyVector()
-	{
-		if (activeZombies_.size() != 0)
-		{ 
-			for (int i = 0; i < activeZombies_.size() - 1; i++)
-			{
-				if (activeZombies_.at(i)->getState() == Zombie::State::Dead)
-					activeZombies_.erase(activeZombies_.begin() + i);
-			}
-		}
-	}
-
 	void World::adaptPlayerVelocity()
 	{
-		sf::Vector2f velocity = player_->getVelocity();
+		GEX_PROFILE_SCOPE("World::adaptPlayerVelocity");
+
+		Player* player = getPlayer();
+		if (!player)
+			return;
+
+		sf::Vector2f velocity = player->getVelocity();
 
 		if (velocity.x != 0.f && velocity.y != 0.f)
-			player_->setVelocity(velocity / std::sqrt(2.f));
+			player->setVelocity(velocity / std::sqrt(2.f));
 	}
 
 	void World::adaptPlayerPosition()
 	{
+		GEX_PROFILE_SCOPE("World::adaptPlayerPosition");
+
+		Player* player = getPlayer();
+		if (!player)
+			return;
+
 		const float BORDER_DISTANCE = 40.f;
 		sf::FloatRect viewBounds(worldView_.getCenter() - worldView_.getSize() / 2.f, worldView_.getSize());
 
-		sf::Vector2f position = player_->getPosition();
+		sf::Vector2f position = player->getPosition();
 		position.x = std::max(position.x, viewBounds.left + BORDER_DISTANCE);
 		position.x = std::min(position.x, viewBounds.left + viewBounds.width - BORDER_DISTANCE);
 
 		position.y = std::max(position.y, viewBounds.top + BORDER_DISTANCE);
 		position.y = std::min(position.y, viewBounds.top + viewBounds.height - BORDER_DISTANCE);
 
-		player_->setPosition(position);
+		player->setPosition(position);
 	}
 
 	void World::updateSound()
 	{
-		sounds_.setListenerPosition(player_->getWorldPosition());
-		sounds_.removeStoppedSounds();
+		GEX_PROFILE_SCOPE("World::updateSound");
+
+		if (!sounds_)
+			return;
+
+		if (Player* player = getPlayer())
+			sounds_->setListenerPosition(player->getWorldPosition());
+
+		sounds_->removeStoppedSounds();
 	}
 
 	//Play a random zombie groan noise for atmosphere every 15 secomds
-	void World::playZombieGroan()
+	void World::playZombieGroan(sf::Time dt)
 	{
-		zombieGroanTimer_ += zombieGroanClock_.restart();
+		GEX_PROFILE_SCOPE("World::playZombieGroan");
+
+		zombieGroanTimer_ += dt;
 
 		if (zombieGroanTimer_ >= sf::seconds(15))
 		{
 			SoundEffectID sound;
 
 			//Randomize groan noise
-			switch (randomInt(3))
+			switch (random_.nextInt(3))
 			{ 
 				case 0:
 					sound = SoundEffectID::ZombieGroan1;
@@ -207,29 +347,22 @@ namespace GEX
 					break;
 			}
 
-			player_->playLocalSound(commandQueue_, sound);
+			if (Player* player = getPlayer())
+				player->playLocalSound(commandQueue_, sound);
+
 			zombieGroanTimer_ -= sf::seconds(15);
 		}
 	}
 
-	void World::spawnEnemies()
+	void World::spawnEnemies(sf::Time dt)
 	{
-		enemySpawnTimer_ += enemySpawnClock_.restart();
+		GEX_PROFILE_SCOPE("World::spawnEnemies");
 
-		while (enemySpawnTimer_ >= enemySpawnDelay_)
-		{
-			if (activeZombies_.size() < 30)
-			{
-				//TODO: Implement enemy randomizer here
-				auto spawnpoint = enemySpawnPoints_[randomInt(3)];
-				std::unique_ptr<Zombie> enemy(new Zombie(Zombie::ZombieType::Zombie, textures_));
-				enemy->setPosition(spawnpoint.x, spawnpoint.y);
-				activeZombies_.push_back(enemy.get());
-				sceneLayers_[Ground]->attachChild(std::move(enemy));
-			}
+		if (!enemySpawning_)
+			return;
 
-			enemySpawnTimer_ -= enemySpawnDelay_;
-		}
+		spawnDirector_.setView(getViewBounds());
+		spawnDirector_.update(dt, *sceneLayers_[Ground], zombieHorde_);
 	}
 
 	sf::FloatRect World::getViewBounds() const
@@ -248,32 +381,16 @@ namespace GEX
 	//Make active enemies chase the player
 	void World::enemiesChasePlayer()
 	{
-		if (player_->getHitpoints() > 0)
-		{ 
-			for (auto e : activeZombies_)
-			{
-				//If zombie is alive, chase player
-				if (e->getType() == Zombie::ZombieType::Zombie && e->getHitpoints() > 0)
-				{
-					auto d = distance(*player_, *e);
+		GEX_PROFILE_SCOPE("World::enemiesChasePlayer");
 
-					sf::Vector2f velocityTemp = unitVector((player_->getWorldPosition() - e->getWorldPosition()) * 10000.f);
+		Player* player = getPlayer();
 
-					if (std::abs(velocityTemp.x) > std::abs(velocityTemp.y))
-					{
-						velocityTemp.y = 0;
-					}
-					else
-					{
-						velocityTemp.x = 0;
-					}
+		if (player && player->getHitpoints() > 0)
+		{
+			sf::Vector2f target = player->getWorldPosition();
 
-					e->setVelocity(velocityTemp * e->getMaxSpeed());
-				}
-				//If zombie is dead, set velocity to 0
-				else 
-					e->setVelocity(0.f, 0.f);
-			}
+			chaseField_.update(target);
+			zombieHorde_.chase(chaseField_, target);
 		}
 	}
 
@@ -298,13 +415,45 @@ namespace GEX
 		}
 	}
 
-	void World::handleCollision()
+	void World::handleCollision(sf::Time dt)
 	{
+		GEX_PROFILE_SCOPE("World::handleCollision");
+
 		//build a list of colliding pairs of SceneNodes
 		std::set<SceneNode::Pair> collisionPairs;
-		sceneGraph_.checkSceneCollision(sceneGraph_, collisionPairs);
 
-		for (SceneNode::Pair pair : collisionPairs)
+		collisionGrid_.clear();
+		sceneGraph_.insertIntoGrid(collisionGrid_);
+		collisionGrid_.findPairs(collisionPairs);
+
+		//Bullets are swept along their path instead of paired by end of tick overlap
+		Command sweepBullets;
+		sweepBullets.category = Category::Type::AlliedProjectile;
+		sweepBullets.action = derivedAction<Projectile>([this](Projectile& projectile, sf::Time)
+		{
+			handleProjectileCollision(projectile);
+		});
+
+		categoryRegistry_.onCommand(sweepBullets, sf::Time::Zero);
+
+		//The set is in pointer order, which differs between runs; handle order makes the
+		//pair resolution the same on every run of a replay
+		orderedPairs_.assign(collisionPairs.begin(), collisionPairs.end());
+		for (SceneNode::Pair& pair : orderedPairs_)
+		{
+			if (isHandleLess(pair.second->getHandle(), pair.first->getHandle()))
+				std::swap(pair.first, pair.second);
+		}
+
+		std::sort(orderedPairs_.begin(), orderedPairs_.end(), [](const SceneNode::Pair& lhs, const SceneNode::Pair& rhs)
+		{
+			if (lhs.first != rhs.first)
+				return isHandleLess(lhs.first->getHandle(), rhs.first->getHandle());
+
+			return isHandleLess(lhs.second->getHandle(), rhs.second->getHandle());
+		});
+
+		for (SceneNode::Pair pair : orderedPairs_)
 		{
 			//Player and Zombie
 			if (matchesCategory(pair, Category::Type::Player, Category::Type::Zombie))
@@ -313,15 +462,15 @@ namespace GEX
 				auto& zombie = static_cast<Zombie&>(*pair.second);
 
 				zombie.setVelocity(0.f, 0.f);
-				zombie.setAttackInterval(zombie.getAttackInterval() + zombie.getAttackClock().restart());
 
-				/*if (zombie.getAttackInterval() > sf::seconds(1.5))
-					zombie.setAttackInterval(sf::seconds(1));*/
+				//Contact time is counted in simulated time so replays hit on the same ticks
+				zombie.setAttackInterval(zombie.getAttackInterval() + dt);
 
 				if (zombie.getAttackInterval() >= zombie.getAttackDelay())
+				{
 					player.damage(zombie.getDamage());
-
-				zombie.setAttackInterval(zombie.getAttackInterval() - zombie.getAttackDelay());
+					zombie.setAttackInterval(zombie.getAttackInterval() - zombie.getAttackDelay());
+				}
 			}
 			//Player and Pickup
 			else if (matchesCategory(pair, Category::Type::Player, Category::Type::Pickup))
@@ -332,76 +481,70 @@ namespace GEX
 				pickup.apply(player);
 				pickup.destroy();
 
-				player_->playLocalSound(commandQueue_, SoundEffectID::CollectPickup);
+				player.playLocalSound(commandQueue_, SoundEffectID::CollectPickup);
 			}
-			//Zombie and Bullet
-			else if (matchesCategory(pair, Category::Type::Zombie, Category::Type::AlliedProjectile))
-			{
-				auto& zombie = static_cast<Zombie&>(*pair.first);
-				auto& projectile = static_cast<Projectile&>(*pair.second);
+		}
+	}
+
+	//Damage the first zombie along the projectile's path this tick
+	void World::handleProjectileCollision(Projectile& projectile)
+	{
+		if (projectile.isDestroyed())
+			return;
 
- 				zombie.damage(projectile.getDamage());
+		sf::FloatRect end = projectile.getBoundingBox();
+		sf::Vector2f displacement = projectile.getDisplacement();
 
-				//If zombie is killed, update score
-				if (zombie.getHitpoints() <= 0)
-				{
-					if (multiplier_ != 0)
-						score_ += 200 * multiplier_;
-					else
-						score_ += 200;
+		sf::FloatRect path = end;
+		path.left -= std::max(displacement.x, 0.f);
+		path.top -= std::max(displacement.y, 0.f);
+		path.width += std::abs(displacement.x);
+		path.height += std::abs(displacement.y);
 
-					//zombie.playLocalSound(commandQueue_, SoundEffectID::ZombieDeath);
+		sweepCandidates_.clear();
+		collisionGrid_.query(path, sweepCandidates_);
 
-					multiplier_++;
-				}
+		Zombie* target = nullptr;
+		float earliest = 1.f;
 
-				projectile.destroy();
-			}
-			//Zombie and Zombie
-			else if (matchesCategory(pair, Category::Type::Zombie, Category::Type::Zombie))
-			{
-				auto& zombie = static_cast<Zombie&>(*pair.first);
-				auto& zombie2 = static_cast<Zombie&>(*pair.second);
+		for (SceneNode* node : sweepCandidates_)
+		{
+			if (!(node->getCategory() & Category::Type::Zombie) || node->isDestroyed())
+				continue;
 
-				//Move zombie based on orientation
-				switch (zombie.getState())
-				{
-					case Zombie::State::Left:
-						zombie.setPosition(zombie.getPosition().x + 5.f, zombie.getPosition().y);
-						break;
-					case Zombie::State::Down:
-						zombie.setPosition(zombie.getPosition().x , zombie.getPosition().y - 5.f);
-						break;
-					case Zombie::State::Right:
-						zombie.setPosition(zombie.getPosition().x - 5.f, zombie.getPosition().y);
-						break;
-					case Zombie::State::Up:
-						zombie.setPosition(zombie.getPosition().x, zombie.getPosition().y + 5.f);
-						break;
-					default:
-						//Do Nothing
-						break;
-				}
+			float time;
+			if (projectile.sweep(node->getBoundingBox(), time) && time <= earliest)
+			{
+				target = static_cast<Zombie*>(node);
+				earliest = time;
 			}
 		}
-	}
 
-	//Set up the 4 spawn points just on the outside of the view port
-	void World::setupSpawnPoints()
-	{
-		Spawnpoint point1(-50.f, worldView_.getSize().y / 2.f);
-		Spawnpoint point2(worldView_.getSize().x / 2.f, -50.f);
-		Spawnpoint point3(1730.f, worldView_.getSize().y / 2.f);
-		Spawnpoint point4(worldView_.getSize().x / 2.f, 1100.f);
+		if (!target)
+			return;
 
-		enemySpawnPoints_.push_back(point1);
-		enemySpawnPoints_.push_back(point2);
-		enemySpawnPoints_.push_back(point3);
-		enemySpawnPoints_.push_back(point4);
+		target->damage(projectile.getDamage());
+
+		//If zombie is killed, update score
+		if (target->getHitpoints() <= 0)
+		{
+			if (multiplier_ != 0)
+				score_ += 200 * multiplier_;
+			else
+				score_ += 200;
+
+			//zombie.playLocalSound(commandQueue_, SoundEffectID::ZombieDeath);
+
+			multiplier_++;
+		}
+
+		projectile.destroy();
 	}
 
 	void World::destroyEntitiesOutOfView()
 	{
+		GEX_PROFILE_SCOPE("World::destroyEntitiesOutOfView");
+
 		Command command;
 		command.category = Category::Type::Projectile;
 		command.action = derivedAction<Entity>([this](Entity& e, sf::Time dt)
@@ -410,15 +553,34 @@ namespace GEX
 				e.remove();
 		});
 
-		commandQueue_.push(command);
+		commandQueue_.push(std::move(command));
 	}
 
 	void World::draw()
 	{
-		target_.setView(worldView_);
-		target_.draw(sceneGraph_);
-		target_.draw(scoreText_);
-		target_.draw(multiplierText_);
+		GEX_PROFILE_SCOPE("World::draw");
+
+		assert(target_);
+
+		target_->setView(worldView_);
+
+		//Entity sprites are merged per texture, the batch is flushed before the HUD goes on top
+		spriteBatch_->resetDrawCallCount();
+		sceneGraph_.draw(*spriteBatch_, sf::RenderStates::Default, interpolation_);
+		spriteBatch_->flush();
+
+		target_->draw(scoreText_);
+		target_->draw(multiplierText_);
+	}
+
+	bool World::isHeadless() const
+	{
+		return target_ == nullptr;
+	}
+
+	void World::setInterpolation(float alpha)
+	{
+		interpolation_ = alpha;
 	}
 
 	CommandQueue& World::getCommandQueue()
@@ -426,9 +588,87 @@ namespace GEX
 		return commandQueue_;
 	}
 
+	CommandStaging& World::getCommandStaging()
+	{
+		return commandStaging_;
+	}
+
 	bool World::hasAlivePlayer() const
 	{
-		return !player_->isDestroyed();
+		Player* player = getPlayer();
+		return player && !player->isDestroyed();
+	}
+
+	unsigned int World::getSeed() const
+	{
+		return seed_;
+	}
+
+	std::uint32_t World::computeChecksum()
+	{
+		std::uint32_t hash = FNV_OFFSET;
+
+		mix(hash, static_cast<std::uint32_t>(score_));
+		mix(hash, static_cast<std::uint32_t>(multiplier_));
+		mix(hash, static_cast<std::uint32_t>(zombieHorde_.getAliveCount()));
+
+		//Positions and hitpoints of everything that moves or can be hurt, in registry order
+		Command digest;
+		digest.category = Category::Type::Player | Category::Type::Zombie | Category::Type::Projectile | Category::Type::Pickup;
+		digest.action = derivedAction<Entity>([&hash](Entity& entity, sf::Time)
+		{
+			sf::Vector2f position = entity.getWorldPosition();
+			mix(hash, position.x);
+			mix(hash, position.y);
+			mix(hash, static_cast<std::uint32_t>(entity.getHitpoints()));
+		});
+
+		categoryRegistry_.onCommand(digest, sf::Time::Zero);
+
+		return hash;
+	}
+
+	sf::Time World::getPhaseTime(UpdatePhase phase) const
+	{
+		return phaseTimes_[static_cast<std::size_t>(phase)];
+	}
+
+	void World::spawnZombie(Zombie::ZombieType type, sf::Vector2f position)
+	{
+		spawnDirector_.spawn(type, position, *sceneLayers_[Ground], zombieHorde_);
+	}
+
+	void World::spawnPickup(Pickup::Type type, sf::Vector2f position)
+	{
+		std::unique_ptr<Pickup> pickup(new Pickup(type, textures_));
+		pickup->setPosition(position);
+		sceneLayers_[Ground]->attachChild(std::move(pickup));
+	}
+
+	//The wave clock stops while spawning is off, switching back resumes the wave where it was
+	void World::setEnemySpawning(bool enabled)
+	{
+		enemySpawning_ = enabled;
+	}
+
+	std::size_t World::getAliveZombieCount() const
+	{
+		return zombieHorde_.getAliveCount();
+	}
+
+	std::size_t World::getWave() const
+	{
+		return spawnDirector_.getWave();
+	}
+
+	sf::FloatRect World::getWorldBounds() const
+	{
+		return worldBounds_;
+	}
+
+	Player* World::getPlayer() const
+	{
+		return entityRegistry_.get<Player>(player_);
 	}
 
 	void World::loadTextures()
@@ -467,10 +707,44 @@ namespace GEX
 		textures_.load(GEX::TextureID::PlayerIdleRight, "Media/Textures/player_idle_right.png");
 
 		textures_.load(GEX::TextureID::PlayerDeath, "Media/Textures/player_death.png");
+
+		//Pack the character sheets together so zombies and the player share one texture binding
+		textures_.packAtlas({
+			GEX::TextureID::Zombie,
+			GEX::TextureID::ZombieWalkUp,
+			GEX::TextureID::ZombieWalkLeft,
+			GEX::TextureID::ZombieWalkDown,
+			GEX::TextureID::ZombieWalkRight,
+			GEX::TextureID::ZombieDeath,
+			GEX::TextureID::Skeleton,
+			GEX::TextureID::SkeletonWalkUp,
+			GEX::TextureID::SkeletonWalkLeft,
+			GEX::TextureID::SkeletonWalkDown,
+			GEX::TextureID::SkeletonWalkRight,
+			GEX::TextureID::PlayerWalkUp,
+			GEX::TextureID::PlayerWalkLeft,
+			GEX::TextureID::PlayerWalkDown,
+			GEX::TextureID::PlayerWalkRight,
+			GEX::TextureID::PlayerIdleUp,
+			GEX::TextureID::PlayerIdleLeft,
+			GEX::TextureID::PlayerIdleDown,
+			GEX::TextureID::PlayerIdleRight,
+			GEX::TextureID::PlayerDeath
+		});
+
+		//Animation clips are cut once from the packed sheets, every zombie plays the same ones
+		for (const auto& pair : initializeAnimationData())
+		{
+			const AnimationData& clip = pair.second;
+			textures_.loadClip(pair.first, clip.texture, clip.frameSize, clip.numFrames, clip.duration, clip.repeat);
+		}
 	}
 
 	void World::buildScene()
 	{
+		// Route commands only to the nodes of the matching categories and hand out entity handles
+		sceneGraph_.setRegistries(&categoryRegistry_, &entityRegistry_);
+
 		// Initialize layers
 		for (int i = 0; i < LayerCount; i++)
 		{
@@ -481,22 +755,29 @@ namespace GEX
 		}
 
 		//Sound
-		std::unique_ptr<SoundNode> sNode(new SoundNode(sounds_));
-		sceneGraph_.attachChild(std::move(sNode));
+		if (sounds_)
+		{
+			std::unique_ptr<SoundNode> sNode(new SoundNode(*sounds_));
+			sceneGraph_.attachChild(std::move(sNode));
+		}
 
-		// draw background
-		sf::Texture& texture = textures_.get(TextureID::LunarBackground);
-		sf::IntRect textureRect(worldBounds_);
-		texture.setRepeated(true);
+		// draw background, purely cosmetic so a headless world goes without
+		if (target_)
+		{
+			sf::Texture& texture = textures_.get(TextureID::LunarBackground);
+			sf::IntRect textureRect(worldBounds_);
+			texture.setRepeated(true);
 
-		std::unique_ptr<SpriteNode> backgroundSprite(new SpriteNode(texture, textureRect));
-		backgroundSprite->setPosition(worldBounds_.left, worldBounds_.top);
-		sceneLayers_[Background]->attachChild(std::move(backgroundSprite));
+			std::unique_ptr<SpriteNode> backgroundSprite(new SpriteNode(texture, textureRect));
+			backgroundSprite->setPosition(worldBounds_.left, worldBounds_.top);
+			sceneLayers_[Background]->attachChild(std::move(backgroundSprite));
+		}
 
 		// Ddd player
 		std::unique_ptr<Player> leader(new Player(Player::Type::Player, textures_));
 		leader->setPosition(spawnPosition_);
-		player_ = leader.get();
+		Player& player = *leader;
 		sceneLayers_[Ground]->attachChild(std::move(leader));
+		player_ = player.getHandle();
 	}
 }
\ No newline at end of file
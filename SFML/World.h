@@ -35,8 +35,8 @@
 
 #pragma once
 
-#include <SFML\Graphics\View.hpp>
-#include <SFML\Graphics\Texture.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/Texture.hpp>
 
 #include "SceneNode.h"
 #include "SpriteNode.h"
@@ -44,10 +44,23 @@
 #include "Player.h"
 #include "Category.h"
 #include "CommandQueue.h"
+#include "CommandStaging.h"
 #include "SoundPlayer.h"
 #include "Zombie.h"
+#include "Pickup.h"
 #include "Skeleton.h"
-
+#include "SpatialHashGrid.h"
+#include "CategoryRegistry.h"
+#include "ZombieHorde.h"
+#include "FlowField.h"
+#include "SpawnDirector.h"
+#include "EntityRegistry.h"
+#include "SpriteBatch.h"
+#include "Random.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace sf
@@ -57,32 +70,61 @@ namespace sf
 
 namespace GEX
 { 
-	struct Spawnpoint
-	{
-		Spawnpoint(/*Aircraft::Type _type, */float _x, float _y)
-			/*: type(_type)*/
-			: x(_x)
-			, y(_y)
-		{}
-
-		/*Aircraft::Type type;*/
-		float			x;
-		float			y;
-	};
-
 	class World
 	{
 	public:
-		explicit					World(sf::RenderWindow& window, SoundPlayer& sounds);
+		//Stages of World::update, in the order they run
+		enum class UpdatePhase
+		{
+			Commands,
+			Collision,
+			Spawning,
+			Movement,
+			Presentation,
+			Steering,
+			Count
+		};
+
+	public:
+			//the seed fixes every random decision, the same seed and input replay the same game
+									World(sf::RenderWindow& window, SoundPlayer& sounds, unsigned int seed);
+
+			//simulation only, no window, no audio and no texture decoding, draw() must not be called
+									World(sf::Vector2f viewSize, unsigned int seed);
 
 		void						update(sf::Time dt, CommandQueue& commands);
 		void						draw();
+		bool						isHeadless() const;
+		void						setInterpolation(float alpha);
 
 		CommandQueue&				getCommandQueue();
 
+			//lanes for worker threads, merged behind the main queue at the start of the next update
+		CommandStaging&				getCommandStaging();
+
 		bool						hasAlivePlayer() const;
 
+		unsigned int				getSeed() const;
+
+			//hash of the score and every entity's position and hitpoints, equal between identical runs
+		std::uint32_t				computeChecksum();
+
+			//how long each phase of the last update took
+		sf::Time					getPhaseTime(UpdatePhase phase) const;
+
+			//scenario setup for tools driving the simulation directly
+		void						spawnZombie(Zombie::ZombieType type, sf::Vector2f position);
+		void						spawnPickup(Pickup::Type type, sf::Vector2f position);
+		void						setEnemySpawning(bool enabled);
+		std::size_t					getAliveZombieCount() const;
+		std::size_t					getWave() const;
+		sf::FloatRect				getWorldBounds() const;
+
 	private:
+									World(sf::RenderTarget* target, SoundPlayer* sounds, const sf::View& view, unsigned int seed);
+
+		Player*						getPlayer() const;
+
 		void						loadTextures();
 		void						buildScene();
 		void						adaptPlayerVelocity();
@@ -90,19 +132,17 @@ namespace GEX
 
 		void						updateScoreAndMultiplier();
 
-		void						cleanEnemyVector();
-		void						spawnEnemies();
+		void						spawnEnemies(sf::Time dt);
 
 		sf::FloatRect				getViewBounds() const;
 		sf::FloatRect				getBattlefieldBounds() const;
 
 		void						enemiesChasePlayer();
 
-		void						handleCollision();
+		void						handleCollision(sf::Time dt);
+		void						handleProjectileCollision(Projectile& projectile);
 
-		void						playZombieGroan();
-
-		void						setupSpawnPoints();	
+		void						playZombieGroan(sf::Time dt);
 
 		void						destroyEntitiesOutOfView();
 
@@ -118,34 +158,44 @@ namespace GEX
 		};
 
 	private:
-		sf::RenderWindow&			target_;
+		unsigned int				seed_;
+		Random						random_;		// every random decision in the simulation, so the seed fixes the whole run
+		sf::RenderTarget*			target_;
 		sf::View					worldView_;
 		TextureManager				textures_;
-		SoundPlayer&				sounds_;
+		SoundPlayer*				sounds_;
+
+		// Registries and the horde are declared first so they outlive the scene graph's nodes
+		CategoryRegistry			categoryRegistry_;
+		EntityRegistry				entityRegistry_;
+		ZombieHorde					zombieHorde_;
+		SpawnDirector				spawnDirector_;		// its reserve of zombies refers to textures_ and random_
 
 		SceneNode					sceneGraph_;
 		std::vector<SceneNode*>		sceneLayers_;
+		std::unique_ptr<SpriteBatch>	spriteBatch_;
+		float						interpolation_;
 
 		CommandQueue				commandQueue_;
+		CommandStaging				commandStaging_;
+		SpatialHashGrid				collisionGrid_;
+		std::vector<SceneNode*>		sweepCandidates_;
+		std::vector<SceneNode::Pair>	orderedPairs_;
 		sf::FloatRect				worldBounds_;
+		FlowField					chaseField_;
 		sf::Vector2f				spawnPosition_;
 		float						scrollSpeed_;
-		Player*						player_;
-
-		std::vector<Spawnpoint>		enemySpawnPoints_;
-
-		std::vector<Zombie*>		activeZombies_;
+		EntityHandle				player_;
 
 		sf::Text					scoreText_;
 		sf::Text					multiplierText_;
 		int							multiplier_;
 		int							score_;
 
-		sf::Time					enemySpawnDelay_;
-		sf::Time					enemySpawnTimer_;
-		sf::Clock					enemySpawnClock_;
+		std::array<sf::Time, static_cast<std::size_t>(UpdatePhase::Count)>	phaseTimes_;
+
+		bool						enemySpawning_;
 
 		sf::Time					zombieGroanTimer_;
-		sf::Clock					zombieGroanClock_;
 	};
 }
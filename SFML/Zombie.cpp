@@ -38,8 +38,10 @@
 #include "Utility.h"
 #include "SoundNode.h"
 #include "Command.h"
+#include "ZombieHorde.h"
+#include "NodePool.h"
+#include "SpriteBatch.h"
 
-using namespace std::placeholders;
 
 namespace GEX
 { 
@@ -48,60 +50,53 @@ namespace GEX
 		const std::map<Zombie::ZombieType, ZombieData> TABLE = initializeZombieData();
 	}
 
-	Zombie::Zombie(Zombie::ZombieType type, const TextureManager& textures)
+	Zombie::Zombie(Zombie::ZombieType type, const TextureManager& textures, Random& random)
 		: Entity(TABLE.at(type).hitpoints)
 		, type_(type)
 		, state_()
-		, walkUp_(textures.get(TextureID::ZombieWalkUp))
-		, walkLeft_(textures.get(TextureID::ZombieWalkLeft))
-		, walkDown_(textures.get(TextureID::ZombieWalkDown))
-		, walkRight_(textures.get(TextureID::ZombieWalkRight))
-		, death_(textures.get(TextureID::ZombieDeath))
-		, sprite_(textures.get(TABLE.at(type).texture))
-		, animations_()
+		, random_(random)
+		, animation_(nullptr)
+		, stateTime_(sf::Time::Zero)
+		, localBounds_()
 		, travelDistance_(0.f)
 		, directionIndex_(0)
 		, attackCommand_()
 		, spawnPickup_(false)
-		, dropPickupCommand_()
+		, textures_(textures)
 		, showDeath_(false)
 		, hasPlayedDeathSound_(false)
 		, attackInterval_(sf::Time::Zero)
-		, attackClock_()
+		, horde_(nullptr)
+		, hordeIndex_(0)
 	{
-		setupAnimations();
+		const sf::IntRect& rect = textures.getTextureRect(TABLE.at(type).texture);
+		localBounds_ = sf::FloatRect(0.f, 0.f, static_cast<float>(rect.width), static_cast<float>(rect.height));
 
-		//Set up drop pickup command
-		dropPickupCommand_.category = Category::GroundLayer;
-		dropPickupCommand_.action = [this, &textures](SceneNode& node, sf::Time dt)
-		{
-			createPickup(node, textures);
-		};
+		playStateAnimation();
 	}
 
-	void Zombie::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	Zombie::~Zombie()
 	{
-		switch (state_)
-		{
-		case Zombie::State::Up:
-			target.draw(walkUp_, states);
-			break;
-		case Zombie::State::Left:
-			target.draw(walkLeft_, states);
-			break;
-		case Zombie::State::Down:
-			target.draw(walkDown_, states);
-			break;
-		case Zombie::State::Right:
-			target.draw(walkRight_, states);
-			break;
-		case Zombie::State::Dead:
-			target.draw(death_, states);
-			break;
-		default:
-			//Do Nothing
-			break;
-		}
+		//Leave the horde the moment the node is freed, no per tick sweep needed
+		if (horde_)
+			horde_->remove(hordeIndex_);
+	}
+
+	void* Zombie::operator new(std::size_t size)
+	{
+		return NodePool<Zombie>::getInstance().allocate(size);
+	}
+
+	void Zombie::operator delete(void* block, std::size_t size)
+	{
+		NodePool<Zombie>::getInstance().deallocate(block, size);
+	}
+
+	void Zombie::drawCurrent(SpriteBatch& batch, sf::RenderStates states) const
+	{
+		//The frame is only worked out here, so zombies out of view cost no animation work at all
+		if (animation_)
+			batch.draw(*animation_, getStateTime(), states);
 	}
 
 	unsigned int Zombie::getCategory() const
@@ -109,9 +104,9 @@ namespace GEX
 		return Category::Zombie;
 	}
 
-	sf::FloatRect Zombie::getBoundingBox() const
+	sf::FloatRect Zombie::computeBoundingBox() const
 	{
-		auto box = getWorldTransform().transformRect(sprite_.getGlobalBounds());
+		auto box = getWorldTransform().transformRect(localBounds_);
 
 		box.left -= 15;
 		box.top -= 20;
@@ -121,12 +116,16 @@ namespace GEX
 
 	bool Zombie::isMarkedForRemoval() const
 	{
-		return isDestroyed() && death_.isFinished();
+		return isDestroyed() && state_ == Zombie::State::Dead && animation_ && animation_->isFinished(getStateTime());
 	}
 
 	void Zombie::remove()
 	{
 		Entity::remove();
+
+		if (horde_)
+			horde_->setHitpoints(hordeIndex_, 0);
+
 		showDeath_ = false;
 	}
 
@@ -154,61 +153,123 @@ namespace GEX
 	{
 		Command playSoundCommand;
 		playSoundCommand.category = Category::SoundEffect;
-		playSoundCommand.action = derivedAction<SoundNode>(
-			std::bind(&SoundNode::playSound, _1, effect, getWorldPosition())
-			);
+		playSoundCommand.action = derivedAction<SoundNode>([effect, position = getWorldPosition()](SoundNode& node, sf::Time)
+		{
+			node.playSound(effect, position);
+		});
 
-		commands.push(playSoundCommand);
+		commands.push(std::move(playSoundCommand));
 	}
 
-	sf::Clock Zombie::getAttackClock() const
+	sf::Time Zombie::getAttackDelay() const
 	{
-		return attackClock_;
+		return TABLE.at(type_).attackInterval;
 	}
 
-	void Zombie::setAttackClock(sf::Clock clock)
+	bool Zombie::isInHorde() const
 	{
-		attackClock_ = clock;
+		return horde_ != nullptr;
 	}
 
-	sf::Time Zombie::getAttackDelay() const
+	void Zombie::joinHorde(ZombieHorde* horde, std::size_t index)
 	{
-		return TABLE.at(type_).attackInterval;
+		horde_ = horde;
+		hordeIndex_ = index;
+	}
+
+	void Zombie::leaveHorde()
+	{
+		assert(horde_);
+
+		//Hand the simulation data back to the node
+		Entity::setVelocity(horde_->getVelocity(hordeIndex_));
+
+		int difference = horde_->getHitpoints(hordeIndex_) - Entity::getHitpoints();
+		if (difference > 0)
+			Entity::repair(difference);
+		else if (difference < 0)
+			Entity::damage(-difference);
+
+		state_ = horde_->getState(hordeIndex_);
+		stateTime_ = horde_->getStateTime(hordeIndex_);
+		horde_ = nullptr;
+	}
+
+	void Zombie::setPosition(float x, float y)
+	{
+		setPosition(sf::Vector2f(x, y));
+	}
+
+	void Zombie::setPosition(const sf::Vector2f& position)
+	{
+		SceneNode::setPosition(position);
+
+		if (horde_)
+			horde_->setPosition(hordeIndex_, position);
+	}
+
+	void Zombie::setVelocity(sf::Vector2f velocity)
+	{
+		if (horde_)
+			horde_->setVelocity(hordeIndex_, velocity);
+		else
+			Entity::setVelocity(velocity);
+	}
+
+	sf::Vector2f Zombie::getVelocity() const
+	{
+		return horde_ ? horde_->getVelocity(hordeIndex_) : Entity::getVelocity();
+	}
+
+	bool Zombie::isDestroyed() const
+	{
+		return getHitpoints() <= 0;
+	}
+
+	void Zombie::damage(int points)
+	{
+		assert(points > 0);
+
+		if (horde_)
+			horde_->setHitpoints(hordeIndex_, horde_->getHitpoints(hordeIndex_) - points);
+		else
+			Entity::damage(points);
+	}
+
+	void Zombie::repair(int points)
+	{
+		assert(points > 0);
+
+		if (horde_)
+			horde_->setHitpoints(hordeIndex_, horde_->getHitpoints(hordeIndex_) + points);
+		else
+			Entity::repair(points);
+	}
+
+	int Zombie::getHitpoints() const
+	{
+		return horde_ ? horde_->getHitpoints(hordeIndex_) : Entity::getHitpoints();
 	}
 
 	void Zombie::updateCurrent(sf::Time dt, CommandQueue & commands)
 	{
-		//Update the states
-		updateStates(dt);
+		Zombie::State previous = state_;
 
-		switch (state_)
-		{
-			case Zombie::State::Up:
-				walkUp_.update(dt);
-				break;
-			case Zombie::State::Left:
-				walkLeft_.update(dt);
-				break;
-			case Zombie::State::Down:
-				walkDown_.update(dt);
-				break;
-			case Zombie::State::Right:
-				walkRight_.update(dt);
-				break;
-			case Zombie::State::Dead:
-				death_.update(dt);
-			default:
-				//Do Nothing
-				break;
-		}
+		//Update the states, the horde has already done it for its members
+		if (horde_)
+			state_ = horde_->getState(hordeIndex_);
+		else
+			updateStates(dt);
+
+		if (state_ != previous)
+			playStateAnimation();
 
-		Entity::updateCurrent(dt, commands);
+		//Horde members are moved by the horde
+		if (!horde_)
+			Entity::updateCurrent(dt, commands);
 
 		if (isDestroyed() && state_ == Zombie::State::Dead)
 		{
-			//start death animation
-			death_.update(dt);
-
 			//Play Death Sound
 			if (!hasPlayedDeathSound_)
 			{
@@ -242,7 +303,7 @@ namespace GEX
 			}
 		}
 
-
+		stateTime_ += dt;
 	}
 
 	float Zombie::getMaxSpeed() const
@@ -252,17 +313,25 @@ namespace GEX
 
 	void Zombie::setState(Zombie::State state)
 	{
-		state_ = state;
-		animations_[state_].restart();
+		if (state_ != state)
+		{
+			state_ = state;
+			stateTime_ = sf::Time::Zero;
+		}
 	}
 	Zombie::State Zombie::getState() const
 	{
-		return state_;
+		return horde_ ? horde_->getState(hordeIndex_) : state_;
+	}
+
+	sf::Time Zombie::getStateTime() const
+	{
+		return horde_ ? horde_->getStateTime(hordeIndex_) : stateTime_;
 	}
 
 	void Zombie::createPickup(SceneNode & node, const TextureManager & textures) const
 	{
-		auto type = static_cast<Pickup::Type>(randomInt(static_cast<int>(Pickup::Type::Count)));
+		auto type = static_cast<Pickup::Type>(random_.nextInt(static_cast<int>(Pickup::Type::Count)));
 
 		std::unique_ptr<Pickup> pickup(new Pickup(type, textures));
 		pickup->setPosition(getWorldPosition());
@@ -272,48 +341,26 @@ namespace GEX
 
 	void Zombie::checkPickupDrop(CommandQueue & commands)
 	{
-		if (randomInt(3) == 0 && !spawnPickup_)
-			commands.push(dropPickupCommand_);
+		if (random_.nextInt(3) == 0 && !spawnPickup_)
+		{
+			Command dropPickupCommand;
+			dropPickupCommand.category = Category::GroundLayer;
+			dropPickupCommand.action = [this](SceneNode& node, sf::Time dt)
+			{
+				createPickup(node, textures_);
+			};
+			commands.push(std::move(dropPickupCommand));
+		}
 
 		spawnPickup_ = true;
 	}
 
-	void Zombie::setupAnimations()
+	//Every state has its own clip, which starts with the state, so the state time is the clip time
+	void Zombie::playStateAnimation()
 	{
-		walkUp_.setFrameSize(sf::Vector2i(33, 45));
-		walkUp_.setNumFrames(3);
-		walkUp_.setDuration(sf::seconds(0.5));
-		walkUp_.setRepeating(true);
-
-		walkLeft_.setFrameSize(sf::Vector2i(33, 45));
-		walkLeft_.setNumFrames(3);
-		walkLeft_.setDuration(sf::seconds(0.5));
-		walkLeft_.setRepeating(true);
-
-		walkDown_.setFrameSize(sf::Vector2i(33, 45));
-		walkDown_.setNumFrames(3);
-		walkDown_.setDuration(sf::seconds(0.5));
-		walkDown_.setRepeating(true);
-
-		walkRight_.setFrameSize(sf::Vector2i(33, 45));
-		walkRight_.setNumFrames(3);
-		walkRight_.setDuration(sf::seconds(0.5));
-		walkRight_.setRepeating(true);
-
-		death_.setFrameSize(sf::Vector2i(40, 45));
-		death_.setNumFrames(3);
-		death_.setDuration(sf::seconds(1.5f));
-
-		animations_[Zombie::State::Up] = walkUp_;
-		animations_[Zombie::State::Left] = walkLeft_;
-		animations_[Zombie::State::Down] = walkDown_;
-		animations_[Zombie::State::Right] = walkRight_;
-		animations_[Zombie::State::Dead] = death_;
+		const auto& animations = TABLE.at(type_).animations;
+		auto found = animations.find(state_);
 
-		centerOrigin(walkUp_);
-		centerOrigin(walkLeft_);
-		centerOrigin(walkDown_);
-		centerOrigin(walkRight_);
-		centerOrigin(death_);
+		animation_ = found != animations.end() ? &textures_.getClip(found->second) : nullptr;
 	}
 }
\ No newline at end of file
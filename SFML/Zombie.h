@@ -34,12 +34,16 @@
 
 #pragma once
 
-#include "Animation.h"
+#include "AnimationClip.h"
 #include "Entity.h"
 #include "TextureManager.h"
+#include "Random.h"
 
 namespace GEX
 {
+	// forward declaration
+	class ZombieHorde;
+
 	class Zombie : public Entity
 	{
 	public:
@@ -59,12 +63,15 @@ namespace GEX
 		};
 
 	public:
-								Zombie(Zombie::ZombieType type, const TextureManager& textures);
+								Zombie(Zombie::ZombieType type, const TextureManager& textures, Random& random);
+								~Zombie();
 
-		void					drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
-		unsigned int			getCategory() const override;
+			//instances are carved from NodePool<Zombie> and recycled when the scene graph deletes them
+		static void*			operator new(std::size_t size);
+		static void				operator delete(void* block, std::size_t size);
 
-		sf::FloatRect			getBoundingBox() const override;
+		void					drawCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
+		unsigned int			getCategory() const override;
 
 		bool					isMarkedForRemoval() const override;
 
@@ -72,6 +79,7 @@ namespace GEX
 
 		Zombie::ZombieType		getType() const;
 		Zombie::State			getState() const;
+		sf::Time				getStateTime() const;	// also how far into its clip the zombie is
 
 		void					playLocalSound(CommandQueue& commands, SoundEffectID effect);
 
@@ -81,12 +89,27 @@ namespace GEX
 		sf::Time				getAttackInterval() const;
 		void					setAttackInterval(sf::Time interval);
 
-		sf::Clock				getAttackClock() const;
-		void					setAttackClock(sf::Clock clock);
-
 		sf::Time				getAttackDelay() const;
 
+			//horde adapter, while in a horde the zombie's simulation data lives in the horde's arrays
+		bool					isInHorde() const;
+		void					joinHorde(ZombieHorde* horde, std::size_t index);
+		void					leaveHorde();
+
+		void					setPosition(float x, float y);
+		void					setPosition(const sf::Vector2f& position);
+
+		using Entity::setVelocity;
+		void					setVelocity(sf::Vector2f velocity) override;
+		sf::Vector2f			getVelocity() const override;
+
+		bool					isDestroyed() const override;
+		void					damage(int points) override;
+		void					repair(int points) override;
+		int						getHitpoints() const override;
+
 	protected:
+		sf::FloatRect			computeBoundingBox() const override;
 		void					updateCurrent(sf::Time dt, CommandQueue& commands) override;
 
 	private:
@@ -98,35 +121,32 @@ namespace GEX
 		void					createPickup(SceneNode& node, const TextureManager& textures) const;
 		void					checkPickupDrop(CommandQueue& commands);
 
-		void					setupAnimations();
+		void					playStateAnimation();
 
 	private:
 		Zombie::ZombieType				   type_;
 		Zombie::State					   state_;
+		Random&							   random_;
 
-		Animation						   walkUp_;
-		Animation						   walkLeft_;
-		Animation						   walkDown_;
-		Animation						   walkRight_;
-		Animation						   death_;
-
-		sf::Sprite						   sprite_;
-
-		std::map<Zombie::State, Animation> animations_;
+		const AnimationClip*			   animation_;		// shared through textures_, null while idle
+		sf::Time						   stateTime_;		// outside a horde only, a member's lives in the horde
+		sf::FloatRect					   localBounds_;
 
 		float							   travelDistance_;
 		std::size_t						   directionIndex_;
 
 		sf::Time						   attackInterval_;
-		sf::Clock						   attackClock_;
 
 		Command							   attackCommand_;
 
 		bool							   spawnPickup_;
 
-		Command							   dropPickupCommand_;
+		const TextureManager&			   textures_;
 										   
 		bool							   showDeath_;
 		bool							   hasPlayedDeathSound_;
+
+		ZombieHorde*					   horde_;
+		std::size_t						   hordeIndex_;
 	};
 }
@@ -0,0 +1,381 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* ZombieHorde Class
+* Structure-of-arrays storage for the simulation data of every zombie
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "ZombieHorde.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+namespace GEX
+{
+	namespace
+	{
+		std::size_t bucketOf(int x, int y, std::size_t bucketCount)
+		{
+			std::uint32_t hash = static_cast<std::uint32_t>(x) * 73856093u ^ static_cast<std::uint32_t>(y) * 19349663u;
+			return hash & (bucketCount - 1);
+		}
+
+		int cellOf(float coordinate, float cellSize)
+		{
+			return static_cast<int>(std::floor(coordinate / cellSize));
+		}
+	}
+
+	ZombieHorde::ZombieHorde()
+		: positions_()
+		, velocities_()
+		, speeds_()
+		, hitpoints_()
+		, states_()
+		, stateTimes_()
+		, nodes_()
+		, bucketStarts_()
+		, bucketEntries_()
+		, entryBuckets_()
+		, separateCalls_(0)
+	{
+	}
+
+	std::size_t ZombieHorde::add(Zombie& zombie)
+	{
+		assert(!zombie.isInHorde());
+
+		std::size_t index = nodes_.size();
+
+		positions_.push_back(zombie.getPosition());
+		velocities_.push_back(zombie.getVelocity());
+		speeds_.push_back(zombie.getMaxSpeed());
+		hitpoints_.push_back(zombie.getHitpoints());
+		states_.push_back(zombie.getState());
+		stateTimes_.push_back(sf::Time::Zero);
+		nodes_.push_back(&zombie);
+
+		zombie.joinHorde(this, index);
+
+		return index;
+	}
+
+	void ZombieHorde::update(sf::Time dt)
+	{
+		updateStates();
+		integrate(dt);
+		syncNodes();
+	}
+
+	void ZombieHorde::chase(const FlowField& field, sf::Vector2f target)
+	{
+		for (std::size_t i = 0; i < positions_.size(); ++i)
+		{
+			//Dead zombies stand still
+			if (hitpoints_[i] <= 0)
+			{
+				velocities_[i] = sf::Vector2f(0.f, 0.f);
+				continue;
+			}
+
+			sf::Vector2f direction = field.getDirection(positions_[i]);
+
+			//In the target's cell, off the grid or cut off: walk the dominant axis towards the target
+			if (direction.x == 0.f && direction.y == 0.f)
+			{
+				sf::Vector2f offset = target - positions_[i];
+
+				if (std::abs(offset.x) > std::abs(offset.y))
+					direction.x = offset.x < 0.f ? -1.f : 1.f;
+				else if (offset.y != 0.f)
+					direction.y = offset.y < 0.f ? -1.f : 1.f;
+			}
+
+			velocities_[i] = direction * speeds_[i];
+		}
+	}
+
+	void ZombieHorde::separate(float radius, std::size_t maxCandidates)
+	{
+		assert(radius > 0.f);
+		assert(maxCandidates > 0);
+
+		const std::size_t count = positions_.size();
+
+		std::size_t bucketCount = 64;
+		while (bucketCount < count * 2)
+			bucketCount *= 2;
+
+		bucketStarts_.assign(bucketCount + 1, 0);
+		bucketEntries_.resize(count);
+		entryBuckets_.resize(count);
+
+		//Counting sort of the living zombies by bucket, cells are radius wide so neighbours sit in the 3x3 around
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			entryBuckets_[i] = bucketCount;
+
+			if (hitpoints_[i] > 0)
+			{
+				entryBuckets_[i] = bucketOf(cellOf(positions_[i].x, radius), cellOf(positions_[i].y, radius), bucketCount);
+				++bucketStarts_[entryBuckets_[i]];
+			}
+		}
+
+		//running totals make each count its bucket's end, then filling backwards walks every end down to its start
+		for (std::size_t b = 1; b <= bucketCount; ++b)
+			bucketStarts_[b] += bucketStarts_[b - 1];
+
+		for (std::size_t i = count; i > 0; --i)
+		{
+			std::size_t bucket = entryBuckets_[i - 1];
+			if (bucket < bucketCount)
+				bucketEntries_[--bucketStarts_[bucket]] = i - 1;
+		}
+
+		const float radiusSquared = radius * radius;
+		++separateCalls_;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (hitpoints_[i] <= 0)
+				continue;
+
+			const int cx = cellOf(positions_[i].x, radius);
+			const int cy = cellOf(positions_[i].y, radius);
+
+			std::size_t visited[9];
+			std::size_t visitedCount = 0;
+			std::size_t candidates = 0;
+
+			for (int dy = -1; dy <= 1; ++dy)
+			{
+				for (int dx = -1; dx <= 1; ++dx)
+				{
+					//two cells can share a bucket, visit it once
+					std::size_t bucket = bucketOf(cx + dx, cy + dy, bucketCount);
+					if (bucketStarts_[bucket] == bucketStarts_[bucket + 1] ||
+						std::find(visited, visited + visitedCount, bucket) != visited + visitedCount)
+						continue;
+
+					visited[visitedCount++] = bucket;
+					candidates += bucketStarts_[bucket + 1] - bucketStarts_[bucket];
+				}
+			}
+
+			//Past the cap only a window of the candidates is read. It starts somewhere else for every
+			//zombie and every call, so no cell is favoured and a packed crowd costs the same per zombie
+			std::size_t examined = std::min(candidates, maxCandidates);
+			std::size_t skip = 0;
+			if (candidates > maxCandidates)
+				skip = (i * 2654435761u + separateCalls_ * 40503u) % candidates;
+
+			std::size_t v = 0;
+			while (skip >= bucketStarts_[visited[v] + 1] - bucketStarts_[visited[v]])
+			{
+				skip -= bucketStarts_[visited[v] + 1] - bucketStarts_[visited[v]];
+				++v;
+			}
+
+			sf::Vector2f push(0.f, 0.f);
+			std::size_t e = bucketStarts_[visited[v]] + skip;
+
+			for (std::size_t n = 0; n < examined; ++n)
+			{
+				std::size_t j = bucketEntries_[e];
+
+				if (++e == bucketStarts_[visited[v] + 1])
+				{
+					v = (v + 1) % visitedCount;
+					e = bucketStarts_[visited[v]];
+				}
+
+				if (j == i)
+					continue;
+
+				sf::Vector2f away = positions_[i] - positions_[j];
+				float distanceSquared = away.x * away.x + away.y * away.y;
+				if (distanceSquared >= radiusSquared)
+					continue;
+
+				float distance = std::sqrt(distanceSquared);
+
+				//stacked exactly, split them along x by index so both sides agree
+				if (distance == 0.f)
+					away = sf::Vector2f(i < j ? -1.f : 1.f, 0.f);
+				else
+					away /= distance;
+
+				push += away * (1.f - distance / radius);
+			}
+
+			//bounded: a crowd pushes no harder than a single full overlap
+			float pushLength = std::sqrt(push.x * push.x + push.y * push.y);
+			if (pushLength > 1.f)
+			{
+				push /= pushLength;
+				pushLength = 1.f;
+			}
+
+			//the tighter the squeeze the more the push wins over the chase, so crowds spread
+			//out instead of pressing into each other, and never faster than top speed
+			velocities_[i] = velocities_[i] * (1.f - pushLength) + push * speeds_[i];
+		}
+	}
+
+	std::size_t ZombieHorde::getSize() const
+	{
+		return nodes_.size();
+	}
+
+	std::size_t ZombieHorde::getAliveCount() const
+	{
+		std::size_t count = 0;
+
+		for (int hitpoints : hitpoints_)
+		{
+			if (hitpoints > 0)
+				++count;
+		}
+
+		return count;
+	}
+
+	sf::Vector2f ZombieHorde::getPosition(std::size_t index) const
+	{
+		return positions_[index];
+	}
+
+	void ZombieHorde::setPosition(std::size_t index, sf::Vector2f position)
+	{
+		positions_[index] = position;
+	}
+
+	sf::Vector2f ZombieHorde::getVelocity(std::size_t index) const
+	{
+		return velocities_[index];
+	}
+
+	void ZombieHorde::setVelocity(std::size_t index, sf::Vector2f velocity)
+	{
+		velocities_[index] = velocity;
+	}
+
+	int ZombieHorde::getHitpoints(std::size_t index) const
+	{
+		return hitpoints_[index];
+	}
+
+	void ZombieHorde::setHitpoints(std::size_t index, int hitpoints)
+	{
+		hitpoints_[index] = hitpoints;
+	}
+
+	Zombie::State ZombieHorde::getState(std::size_t index) const
+	{
+		return states_[index];
+	}
+
+	sf::Time ZombieHorde::getStateTime(std::size_t index) const
+	{
+		return stateTimes_[index];
+	}
+
+	void ZombieHorde::updateStates()
+	{
+		for (std::size_t i = 0; i < states_.size(); ++i)
+		{
+			Zombie::State state;
+
+			if (hitpoints_[i] <= 0)
+				state = Zombie::State::Dead;
+			else if (std::abs(velocities_[i].y) > std::abs(velocities_[i].x))
+				state = velocities_[i].y < 0.f ? Zombie::State::Up : Zombie::State::Down;
+			else
+				state = velocities_[i].x < 0.f ? Zombie::State::Left : Zombie::State::Right;
+
+			if (state != states_[i])
+			{
+				states_[i] = state;
+				stateTimes_[i] = sf::Time::Zero;
+			}
+		}
+	}
+
+	void ZombieHorde::integrate(sf::Time dt)
+	{
+		const float seconds = dt.asSeconds();
+
+		for (std::size_t i = 0; i < positions_.size(); ++i)
+		{
+			positions_[i] += velocities_[i] * seconds;
+			stateTimes_[i] += dt;
+		}
+	}
+
+	void ZombieHorde::syncNodes()
+	{
+		// Bypass Zombie::setPosition, which would write straight back into the arrays
+		for (std::size_t i = 0; i < nodes_.size(); ++i)
+			nodes_[i]->SceneNode::setPosition(positions_[i]);
+	}
+
+	void ZombieHorde::remove(std::size_t index)
+	{
+		nodes_[index]->leaveHorde();
+
+		// Swap with the last zombie so the arrays stay contiguous
+		std::size_t last = nodes_.size() - 1;
+
+		if (index != last)
+		{
+			positions_[index] = positions_[last];
+			velocities_[index] = velocities_[last];
+			speeds_[index] = speeds_[last];
+			hitpoints_[index] = hitpoints_[last];
+			states_[index] = states_[last];
+			stateTimes_[index] = stateTimes_[last];
+			nodes_[index] = nodes_[last];
+
+			nodes_[index]->joinHorde(this, index);
+		}
+
+		positions_.pop_back();
+		velocities_.pop_back();
+		speeds_.pop_back();
+		hitpoints_.pop_back();
+		states_.pop_back();
+		stateTimes_.pop_back();
+		nodes_.pop_back();
+	}
+}
@@ -0,0 +1,104 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* ZombieHorde Class
+* Structure-of-arrays storage for the simulation data of every zombie
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include "Zombie.h"
+#include "FlowField.h"
+
+namespace GEX
+{
+	// Zombie nodes attached to the horde are thin adapters: position, velocity, hitpoints
+	// and state live in contiguous arrays here and are written back to the nodes once per tick
+	class ZombieHorde
+	{
+	public:
+										ZombieHorde();
+
+		std::size_t						add(Zombie& zombie);
+		void							remove(std::size_t index);
+
+		void							update(sf::Time dt);
+			//one field lookup per zombie, straight for the target where the field has no direction
+		void							chase(const FlowField& field, sf::Vector2f target);
+
+			//pushes living zombies apart: each one is steered away from the others closer than radius
+			//among at most maxCandidates it reads, and never ends up faster than its own top speed
+		void							separate(float radius, std::size_t maxCandidates);
+
+		std::size_t						getSize() const;
+		std::size_t						getAliveCount() const;
+
+		sf::Vector2f					getPosition(std::size_t index) const;
+		void							setPosition(std::size_t index, sf::Vector2f position);
+
+		sf::Vector2f					getVelocity(std::size_t index) const;
+		void							setVelocity(std::size_t index, sf::Vector2f velocity);
+
+		int								getHitpoints(std::size_t index) const;
+		void							setHitpoints(std::size_t index, int hitpoints);
+
+		Zombie::State					getState(std::size_t index) const;
+		sf::Time						getStateTime(std::size_t index) const;
+
+	private:
+		void							updateStates();
+		void							integrate(sf::Time dt);
+		void							syncNodes();
+
+	private:
+		std::vector<sf::Vector2f>		positions_;
+		std::vector<sf::Vector2f>		velocities_;
+		std::vector<float>				speeds_;
+		std::vector<int>				hitpoints_;
+		std::vector<Zombie::State>		states_;
+		std::vector<sf::Time>			stateTimes_;
+
+		std::vector<Zombie*>			nodes_;
+
+		// Bucketed by cell hash with a counting sort each call, kept between calls to reuse the memory
+		std::vector<std::size_t>		bucketStarts_;
+		std::vector<std::size_t>		bucketEntries_;
+		std::vector<std::size_t>		entryBuckets_;
+
+		// Moves where each zombie's capped candidate window starts from one call to the next
+		std::size_t						separateCalls_;
+	};
+}
@@ -0,0 +1,110 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Frame statistics test
+* Checks that tail percentiles tell hitches past the histogram's range apart
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "FrameStatistics.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+	const sf::Time FRAME = sf::milliseconds(16);
+	const sf::Time UPDATE = sf::milliseconds(2);
+
+	// One sample in this many is a hitch, so p99 lands among the hitches
+	const std::size_t HITCH_EVERY = 50;
+
+	//A full window of 16 ms frames with a hitch every HITCH_EVERY frames, the hitches spread from first to last
+	void fill(GEX::FrameStatistics& statistics, sf::Time first, sf::Time last)
+	{
+		const std::size_t hitchCount = GEX::FrameStatistics::SampleCount / HITCH_EVERY;
+
+		for (std::size_t i = 0; i < GEX::FrameStatistics::SampleCount; ++i)
+		{
+			if (i % HITCH_EVERY == HITCH_EVERY - 1)
+			{
+				std::size_t hitch = i / HITCH_EVERY;
+				statistics.record(first + (last - first) * (hitch / static_cast<float>(hitchCount - 1)), UPDATE);
+			}
+			else
+			{
+				statistics.record(FRAME, UPDATE);
+			}
+		}
+	}
+
+	bool check(bool condition, const std::string& message)
+	{
+		if (!condition)
+			std::cerr << "FAILED: " << message << "\n";
+
+		return condition;
+	}
+
+	std::string toString(sf::Time time)
+	{
+		return std::to_string(time.asMicroseconds() / 1000.0) + " ms";
+	}
+}
+
+int main()
+{
+	const sf::Time ceiling = sf::microseconds(GEX::FrameStatistics::BucketCount * GEX::FrameStatistics::BucketWidth);
+	bool passed = true;
+
+	GEX::FrameStatistics hitches(FRAME);
+	fill(hitches, sf::milliseconds(80), sf::milliseconds(200));
+
+	sf::Time p99 = hitches.getPercentile(0.99f);
+	passed &= check(p99 > ceiling, "p99 of 80-200 ms hitches is " + toString(p99) + ", not above the histogram's range");
+	passed &= check(p99 >= sf::milliseconds(80) && p99 <= sf::milliseconds(200), "p99 " + toString(p99) + " is not one of the hitches");
+	passed &= check(hitches.getPercentile(1.f) == sf::milliseconds(200), "p100 is not the longest hitch");
+
+	//below the range the histogram still rounds up to a bucket edge
+	sf::Time p50 = hitches.getPercentile(0.5f);
+	passed &= check(p50 >= FRAME && p50 <= FRAME + sf::microseconds(GEX::FrameStatistics::BucketWidth), "p50 " + toString(p50) + " moved off the regular frames");
+
+	//a 50 ms and a 400 ms hitch must not look alike
+	GEX::FrameStatistics shortHitches(FRAME);
+	GEX::FrameStatistics longHitches(FRAME);
+	fill(shortHitches, sf::milliseconds(50), sf::milliseconds(50));
+	fill(longHitches, sf::milliseconds(400), sf::milliseconds(400));
+
+	passed &= check(shortHitches.getPercentile(0.99f) == sf::milliseconds(50), "p99 of 50 ms hitches is " + toString(shortHitches.getPercentile(0.99f)));
+	passed &= check(longHitches.getPercentile(0.99f) == sf::milliseconds(400), "p99 of 400 ms hitches is " + toString(longHitches.getPercentile(0.99f)));
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
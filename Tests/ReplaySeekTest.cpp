@@ -0,0 +1,141 @@
+/**
+* @file
+* @author
+* Justin Lange 2019
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Replay seek test
+* Seeks a recorded game mid-replay and compares the world against a straight-through playback
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "Replay.h"
+#include "World.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+	const sf::Vector2f VIEW_SIZE(1680.f, 1050.f);
+	const unsigned int SEED = 99;
+	const std::size_t KEYFRAME_INTERVAL = 60;
+	const std::size_t RECORDED_TICKS = 600;
+
+	// Between keyframes, so the seek has to fast-forward past the last one
+	const std::size_t SEEK_TICK = 450;
+
+	//A scripted game: the player walks a square and fires every seventh tick, recorded the way GameState does
+	void record(const std::string& path)
+	{
+		GEX::World world(VIEW_SIZE, SEED);
+		GEX::ReplayRecorder recorder(path, SEED, KEYFRAME_INTERVAL);
+		const sf::Time dt = sf::seconds(1.f / 60.f);
+
+		const GEX::Action walk[] = { GEX::Action::MoveLeft, GEX::Action::MoveUp, GEX::Action::MoveRight, GEX::Action::MoveDown };
+
+		for (std::size_t tick = 0; tick < RECORDED_TICKS; ++tick)
+		{
+			if (recorder.isKeyframeDue())
+				recorder.setKeyframe(world.computeChecksum());
+			recorder.endTick(dt);
+
+			world.update(dt, world.getCommandQueue());
+
+			GEX::Action action = walk[(tick / 90) % 4];
+			world.getCommandQueue().push(GEX::makeActionCommand(action));
+			recorder.record(action);
+
+			if (tick % 7 == 0)
+			{
+				world.getCommandQueue().push(GEX::makeActionCommand(GEX::Action::Fire));
+				recorder.record(GEX::Action::Fire);
+			}
+		}
+	}
+
+	bool check(bool condition, const std::string& message)
+	{
+		if (!condition)
+			std::cerr << "FAILED: " << message << "\n";
+
+		return condition;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 2)
+	{
+		std::cerr << "usage: BoxheadReplaySeekTest <scratch replay file>\n"
+				  << "Run from the game folder so Media/ resolves.\n";
+		return EXIT_FAILURE;
+	}
+
+	const std::string path = argv[1];
+	record(path);
+
+	//straight through, feeding every tick
+	GEX::ReplayPlayer straight(path);
+	GEX::World straightWorld(VIEW_SIZE, straight.getSeed());
+
+	std::size_t straightDesyncs = 0;
+	while (straight.getTick() < SEEK_TICK)
+	{
+		if (straight.hasKeyframe() && straight.getKeyframeChecksum() != straightWorld.computeChecksum())
+			++straightDesyncs;
+
+		straight.feed(straightWorld.getCommandQueue());
+		straightWorld.update(straight.getTimePerTick(), straightWorld.getCommandQueue());
+	}
+
+	//the same tick reached through seek
+	GEX::ReplayPlayer seeking(path);
+	GEX::World seekWorld(VIEW_SIZE, seeking.getSeed());
+	std::size_t seekDesyncs = seeking.seek(seekWorld, SEEK_TICK);
+
+	bool passed = true;
+	passed &= check(straightDesyncs == 0, "straight playback desynced");
+	passed &= check(seekDesyncs == 0, "seek passed a mismatched keyframe");
+	passed &= check(seeking.getTick() == SEEK_TICK, "seek stopped at tick " + std::to_string(seeking.getTick()));
+	passed &= check(seekWorld.computeChecksum() == straightWorld.computeChecksum(), "seeked world differs from the straight-through one");
+
+	//seeking back on a fresh world, then playing on normally, arrives at the same state
+	GEX::World rewoundWorld(VIEW_SIZE, seeking.getSeed());
+	seeking.seek(rewoundWorld, SEEK_TICK / 2);
+	passed &= check(seeking.getTick() == SEEK_TICK / 2, "backward seek stopped at tick " + std::to_string(seeking.getTick()));
+
+	while (seeking.getTick() < SEEK_TICK)
+	{
+		seeking.feed(rewoundWorld.getCommandQueue());
+		rewoundWorld.update(seeking.getTimePerTick(), rewoundWorld.getCommandQueue());
+	}
+	passed &= check(rewoundWorld.computeChecksum() == straightWorld.computeChecksum(), "world played on after a backward seek differs");
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}